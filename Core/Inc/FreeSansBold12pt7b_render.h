@@ -0,0 +1,443 @@
+// Generated by Tools/fontspans.py from FreeSansBold12pt7b.h - do not edit
+
+#ifndef __FREESANSBOLD12PT7B_RENDER_H_
+#define __FREESANSBOLD12PT7B_RENDER_H_
+
+#include "gfxfont.h"
+
+const uint8_t FreeSansBold12pt7bSpans[] = {
+	2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2,
+	0, 4, 2, 0, 4, 2, 0, 4, 2, 1, 3, 3, 1, 2, 1, 3,
+	1, 2, 1, 3, 1, 2, 1, 3, 1, 2, 1, 1, 4, 2, 0, 4,
+	2, 0, 4, 2, 0, 4, 4, 0, 4, 2, 4, 4, 0, 4, 2, 4,
+	4, 0, 4, 2, 4, 4, 0, 4, 2, 4, 5, 1, 2, 4, 2, 1,
+	5, 1, 2, 4, 2, 1, 5, 4, 3, 2, 3, 1, 5, 4, 3, 2,
+	3, 1, 5, 4, 2, 3, 2, 2, 2, 1, 12, 2, 1, 12, 2, 1,
+	12, 5, 3, 3, 2, 3, 2, 5, 3, 2, 3, 2, 3, 5, 3, 2,
+	3, 2, 3, 3, 0, 12, 1, 3, 0, 12, 1, 3, 0, 12, 1, 5,
+	2, 2, 3, 2, 4, 5, 1, 3, 2, 3, 4, 5, 1, 3, 2, 3,
+	4, 5, 1, 3, 2, 3, 4, 3, 6, 1, 6, 3, 4, 6, 3, 3,
+	2, 9, 2, 3, 2, 10, 1, 6, 1, 4, 1, 1, 1, 5, 6, 1,
+	3, 2, 1, 2, 4, 5, 1, 3, 2, 1, 6, 5, 1, 4, 1, 1,
+	6, 3, 2, 6, 5, 3, 3, 8, 2, 3, 6, 6, 1, 4, 6, 1,
+	1, 5, 6, 0, 4, 2, 1, 2, 4, 6, 0, 4, 2, 1, 2, 4,
+	6, 0, 5, 1, 1, 1, 5, 3, 1, 11, 1, 3, 2, 9, 2, 3,
+	4, 5, 4, 3, 6, 1, 6, 3, 6, 1, 6, 5, 2, 4, 7, 2,
+	4, 5, 1, 6, 5, 2, 5, 5, 1, 7, 4, 2, 5, 7, 0, 3,
+	2, 3, 3, 2, 6, 7, 0, 2, 4, 2, 3, 2, 6, 7, 0, 3,
+	2, 3, 2, 2, 7, 5, 1, 7, 2, 2, 7, 5, 1, 6, 2, 2,
+	8, 7, 2, 4, 3, 2, 2, 4, 2, 5, 8, 2, 2, 6, 1, 4,
+	8, 1, 2, 8, 6, 7, 2, 2, 3, 2, 3, 6, 7, 1, 3, 2,
+	4, 2, 6, 6, 2, 3, 3, 2, 3, 4, 5, 2, 4, 8, 5, 5,
+	2, 5, 6, 1, 5, 4, 2, 7, 4, 2, 3, 5, 4, 7, 3, 3,
+	7, 6, 3, 2, 9, 5, 5, 2, 4, 2, 3, 5, 5, 2, 4, 2,
+	3, 5, 5, 2, 5, 1, 3, 5, 3, 4, 6, 6, 3, 5, 3, 8,
+	5, 2, 7, 3, 2, 2, 5, 1, 9, 2, 2, 2, 5, 0, 4, 3,
+	7, 2, 5, 0, 4, 4, 5, 3, 5, 0, 4, 5, 4, 3, 5, 0,
+	5, 3, 5, 3, 3, 1, 13, 2, 5, 2, 8, 1, 4, 1, 5, 3,
+	6, 3, 3, 1, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4,
+	3, 1, 2, 1, 3, 1, 2, 1, 2, 4, 2, 2, 3, 3, 3, 2,
+	3, 1, 3, 2, 3, 1, 3, 1, 3, 2, 3, 1, 3, 2, 3, 1,
+	3, 2, 3, 0, 3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 3, 0,
+	3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 3, 0,
+	3, 3, 3, 1, 3, 2, 3, 1, 3, 2, 3, 1, 3, 2, 3, 2,
+	3, 1, 3, 2, 3, 1, 3, 3, 2, 1, 2, 3, 3, 3, 0, 2,
+	4, 3, 0, 3, 3, 3, 1, 3, 2, 3, 1, 3, 2, 3, 2, 3,
+	1, 3, 2, 3, 1, 3, 2, 3, 1, 2, 3, 3, 2, 3, 3, 2,
+	3, 3, 2, 3, 3, 2, 3, 3, 2, 3, 3, 2, 3, 3, 2, 3,
+	3, 3, 2, 3, 1, 3, 2, 3, 1, 3, 2, 3, 1, 3, 1, 3,
+	2, 3, 1, 3, 2, 3, 1, 2, 3, 3, 0, 3, 3, 3, 3, 1,
+	3, 3, 3, 1, 3, 6, 0, 2, 1, 1, 1, 2, 2, 0, 7, 3,
+	2, 3, 2, 3, 2, 3, 2, 5, 1, 2, 1, 2, 1, 5, 2, 1,
+	1, 1, 2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+	4, 3, 4, 2, 0, 11, 2, 0, 11, 2, 0, 11, 3, 4, 3, 4,
+	3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 2, 0, 4, 2,
+	0, 4, 2, 0, 4, 2, 2, 2, 2, 2, 2, 3, 1, 2, 1, 3,
+	0, 2, 2, 2, 0, 6, 2, 0, 6, 2, 0, 6, 2, 0, 4, 2,
+	0, 4, 2, 0, 4, 2, 4, 2, 2, 4, 2, 3, 4, 1, 1, 3,
+	3, 2, 1, 3, 3, 2, 1, 3, 3, 2, 1, 3, 3, 1, 2, 3,
+	2, 2, 2, 3, 2, 2, 2, 3, 2, 2, 2, 3, 2, 1, 3, 3,
+	1, 2, 3, 3, 1, 2, 3, 3, 1, 2, 3, 3, 1, 1, 4, 3,
+	0, 2, 4, 3, 0, 2, 4, 3, 3, 6, 3, 3, 2, 8, 2, 3,
+	1, 10, 1, 5, 1, 4, 2, 4, 1, 4, 0, 4, 4, 4, 4, 0,
+	4, 4, 4, 4, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 0, 4,
+	4, 4, 4, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 0, 4, 4,
+	4, 4, 0, 4, 4, 4, 5, 1, 4, 2, 4, 1, 3, 1, 10, 1,
+	3, 2, 8, 2, 3, 4, 4, 4, 2, 5, 2, 2, 4, 3, 2, 3,
+	4, 2, 0, 7, 2, 0, 7, 2, 3, 4, 2, 3, 4, 2, 3, 4,
+	2, 3, 4, 2, 3, 4, 2, 3, 4, 2, 3, 4, 2, 3, 4, 2,
+	3, 4, 2, 3, 4, 2, 3, 4, 2, 3, 4, 3, 3, 6, 3, 3,
+	2, 8, 2, 3, 1, 10, 1, 4, 0, 5, 2, 5, 4, 0, 4, 4,
+	4, 4, 0, 4, 4, 4, 2, 8, 4, 2, 8, 4, 3, 7, 4, 1,
+	3, 6, 4, 2, 3, 4, 5, 3, 3, 3, 4, 5, 3, 2, 4, 6,
+	3, 2, 3, 7, 2, 1, 11, 2, 1, 11, 2, 1, 11, 3, 3, 5,
+	4, 3, 1, 9, 2, 3, 0, 11, 1, 5, 0, 4, 3, 4, 1, 5,
+	0, 4, 3, 4, 1, 3, 7, 4, 1, 3, 6, 4, 2, 3, 5, 4,
+	3, 3, 5, 5, 2, 3, 7, 4, 1, 2, 8, 4, 2, 8, 4, 4,
+	0, 4, 4, 4, 4, 0, 4, 3, 5, 3, 1, 10, 1, 3, 1, 9,
+	2, 3, 3, 6, 3, 3, 6, 4, 1, 3, 5, 5, 1, 3, 5, 5,
+	1, 3, 4, 6, 1, 5, 3, 2, 1, 4, 1, 5, 3, 1, 2, 4,
+	1, 5, 2, 2, 2, 4, 1, 5, 1, 2, 3, 4, 1, 5, 1, 2,
+	3, 4, 1, 5, 0, 2, 4, 4, 1, 2, 0, 11, 2, 0, 11, 2,
+	0, 11, 3, 6, 4, 1, 3, 6, 4, 1, 3, 6, 4, 1, 3, 6,
+	4, 1, 3, 2, 9, 1, 3, 1, 10, 1, 3, 1, 10, 1, 3, 1,
+	3, 8, 3, 1, 2, 9, 5, 1, 2, 1, 5, 3, 3, 1, 9, 2,
+	3, 0, 11, 1, 4, 0, 4, 3, 5, 2, 8, 4, 2, 8, 4, 2,
+	8, 4, 2, 8, 4, 5, 0, 3, 4, 4, 1, 3, 0, 11, 1, 3,
+	1, 9, 2, 3, 2, 6, 4, 3, 4, 5, 3, 3, 2, 8, 2, 3,
+	1, 10, 1, 4, 1, 4, 2, 5, 3, 0, 4, 8, 5, 0, 4, 1,
+	4, 3, 3, 0, 10, 2, 3, 0, 11, 1, 4, 0, 5, 2, 5, 4,
+	0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 0,
+	4, 4, 4, 4, 1, 4, 2, 5, 3, 1, 10, 1, 3, 2, 8, 2,
+	3, 4, 5, 3, 2, 0, 11, 2, 0, 11, 2, 0, 11, 3, 7, 3,
+	1, 3, 7, 3, 1, 3, 6, 3, 2, 3, 5, 4, 2, 3, 5, 3,
+	3, 3, 4, 4, 3, 3, 4, 3, 4, 3, 3, 4, 4, 3, 3, 4,
+	4, 3, 3, 4, 4, 3, 3, 3, 5, 3, 2, 4, 5, 3, 2, 4,
+	5, 3, 2, 4, 5, 3, 4, 4, 4, 3, 2, 8, 2, 3, 1, 9,
+	2, 5, 1, 4, 2, 4, 1, 5, 1, 3, 4, 3, 1, 5, 1, 3,
+	4, 3, 1, 5, 2, 3, 2, 3, 2, 3, 3, 6, 3, 3, 2, 8,
+	2, 5, 1, 4, 2, 4, 1, 4, 0, 4, 4, 4, 4, 0, 4, 4,
+	4, 4, 0, 4, 4, 4, 4, 0, 5, 2, 5, 3, 1, 10, 1, 3,
+	2, 8, 2, 3, 3, 6, 3, 3, 3, 5, 4, 3, 2, 8, 2, 3,
+	1, 10, 1, 5, 0, 5, 2, 4, 1, 5, 0, 4, 4, 3, 1, 4,
+	0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 0,
+	5, 2, 5, 2, 1, 11, 2, 2, 10, 4, 3, 4, 1, 4, 3, 8,
+	3, 1, 5, 0, 4, 3, 4, 1, 3, 1, 10, 1, 3, 1, 9, 2,
+	3, 3, 5, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 1, 4, 1,
+	4, 1, 4, 1, 4, 1, 4, 1, 4, 2, 0, 4, 2, 0, 4, 2,
+	0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 1, 4, 1, 4, 1,
+	4, 1, 4, 1, 4, 1, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4,
+	2, 3, 1, 2, 3, 1, 3, 1, 2, 1, 3, 0, 2, 2, 2, 11,
+	1, 2, 9, 3, 2, 6, 6, 3, 3, 7, 2, 3, 1, 6, 5, 3,
+	0, 5, 7, 3, 0, 3, 9, 3, 0, 6, 6, 3, 2, 7, 3, 2,
+	5, 7, 2, 8, 4, 2, 10, 2, 2, 0, 12, 2, 0, 12, 2, 0,
+	12, 1, 12, 1, 12, 1, 12, 2, 0, 12, 2, 0, 12, 2, 0, 12,
+	1, 12, 3, 0, 3, 9, 3, 0, 6, 6, 3, 1, 7, 4, 3, 4,
+	7, 1, 2, 7, 5, 2, 8, 4, 2, 5, 7, 3, 3, 6, 3, 3,
+	0, 7, 5, 3, 0, 4, 8, 3, 0, 1, 11, 3, 3, 5, 4, 3,
+	1, 9, 2, 3, 1, 10, 1, 4, 0, 5, 2, 5, 4, 0, 4, 4,
+	4, 4, 0, 4, 4, 4, 2, 8, 4, 2, 8, 4, 3, 7, 4, 1,
+	3, 6, 4, 2, 3, 5, 4, 3, 3, 4, 4, 4, 3, 4, 3, 5,
+	3, 4, 3, 5, 1, 12, 3, 4, 4, 4, 3, 4, 4, 4, 3, 4,
+	4, 4, 3, 8, 7, 6, 3, 6, 11, 4, 5, 4, 4, 6, 4, 3,
+	5, 3, 3, 10, 3, 2, 5, 2, 3, 12, 3, 1, 9, 2, 2, 5,
+	4, 1, 2, 2, 2, 1, 8, 1, 2, 4, 6, 1, 2, 3, 2, 8,
+	1, 2, 3, 3, 3, 3, 4, 2, 8, 0, 2, 4, 2, 5, 2, 4,
+	2, 8, 0, 2, 4, 2, 5, 2, 4, 2, 8, 0, 2, 3, 2, 6,
+	2, 4, 2, 8, 0, 2, 3, 2, 5, 2, 4, 3, 9, 0, 2, 3,
+	2, 5, 2, 4, 2, 1, 9, 0, 2, 3, 3, 3, 3, 3, 3, 1,
+	7, 0, 3, 3, 6, 1, 6, 2, 7, 1, 2, 4, 4, 2, 4, 4,
+	3, 1, 3, 17, 3, 2, 3, 16, 5, 3, 4, 7, 1, 6, 3, 4,
+	12, 5, 3, 7, 7, 7, 3, 6, 5, 5, 3, 6, 5, 5, 3, 6,
+	5, 5, 3, 5, 7, 4, 3, 5, 7, 4, 5, 5, 3, 1, 3, 4,
+	5, 4, 4, 1, 4, 3, 5, 4, 3, 2, 4, 3, 5, 4, 3, 3,
+	3, 3, 5, 3, 4, 3, 4, 2, 5, 3, 3, 4, 4, 2, 3, 2,
+	12, 2, 3, 2, 13, 1, 3, 2, 13, 1, 5, 1, 4, 7, 3, 1,
+	4, 1, 4, 7, 4, 4, 1, 3, 8, 4, 4, 0, 4, 9, 3, 3,
+	0, 10, 4, 3, 0, 12, 2, 3, 0, 12, 2, 5, 0, 4, 4, 5,
+	1, 5, 0, 4, 5, 4, 1, 5, 0, 4, 5, 4, 1, 5, 0, 4,
+	4, 5, 1, 3, 0, 12, 2, 3, 0, 11, 3, 3, 0, 12, 2, 5,
+	0, 4, 5, 4, 1, 4, 0, 4, 6, 4, 4, 0, 4, 6, 4, 4,
+	0, 4, 6, 4, 4, 0, 4, 5, 5, 3, 0, 13, 1, 3, 0, 13,
+	1, 3, 0, 11, 3, 3, 5, 6, 5, 3, 3, 10, 3, 3, 2, 12,
+	2, 5, 1, 5, 4, 5, 1, 4, 1, 4, 6, 5, 4, 0, 5, 7,
+	4, 3, 0, 4, 12, 3, 0, 4, 12, 3, 0, 4, 12, 3, 0, 4,
+	12, 3, 0, 4, 12, 3, 0, 4, 12, 4, 0, 5, 7, 4, 4, 1,
+	4, 6, 5, 5, 1, 5, 4, 5, 1, 3, 2, 13, 1, 3, 3, 11,
+	2, 3, 5, 7, 4, 3, 0, 11, 4, 3, 0, 12, 3, 3, 0, 13,
+	2, 5, 0, 4, 5, 5, 1, 5, 0, 4, 6, 4, 1, 4, 0, 4,
+	6, 5, 4, 0, 4, 7, 4, 4, 0, 4, 7, 4, 4, 0, 4, 7,
+	4, 4, 0, 4, 7, 4, 4, 0, 4, 7, 4, 4, 0, 4, 7, 4,
+	4, 0, 4, 6, 5, 5, 0, 4, 6, 4, 1, 5, 0, 4, 5, 5,
+	1, 3, 0, 13, 2, 3, 0, 12, 3, 3, 0, 10, 5, 3, 0, 12,
+	1, 3, 0, 12, 1, 3, 0, 12, 1, 3, 0, 4, 9, 3, 0, 4,
+	9, 3, 0, 4, 9, 3, 0, 4, 9, 3, 0, 11, 2, 3, 0, 11,
+	2, 3, 0, 11, 2, 3, 0, 4, 9, 3, 0, 4, 9, 3, 0, 4,
+	9, 3, 0, 4, 9, 3, 0, 4, 9, 2, 0, 13, 2, 0, 13, 2,
+	0, 13, 2, 0, 12, 2, 0, 12, 2, 0, 12, 3, 0, 4, 8, 3,
+	0, 4, 8, 3, 0, 4, 8, 3, 0, 4, 8, 3, 0, 11, 1, 3,
+	0, 11, 1, 3, 0, 11, 1, 3, 0, 4, 8, 3, 0, 4, 8, 3,
+	0, 4, 8, 3, 0, 4, 8, 3, 0, 4, 8, 3, 0, 4, 8, 3,
+	0, 4, 8, 3, 0, 4, 8, 3, 6, 6, 4, 3, 4, 10, 2, 3,
+	2, 13, 1, 4, 2, 5, 4, 5, 4, 1, 4, 8, 3, 3, 1, 4,
+	11, 3, 0, 4, 12, 3, 0, 4, 12, 4, 0, 4, 5, 7, 4, 0,
+	4, 5, 7, 4, 0, 4, 5, 7, 4, 0, 4, 9, 3, 4, 1, 4,
+	8, 3, 4, 1, 5, 6, 4, 4, 2, 5, 4, 5, 4, 2, 11, 1,
+	2, 4, 4, 9, 1, 2, 4, 6, 5, 3, 2, 4, 0, 4, 6, 4,
+	4, 0, 4, 6, 4, 4, 0, 4, 6, 4, 4, 0, 4, 6, 4, 4,
+	0, 4, 6, 4, 4, 0, 4, 6, 4, 4, 0, 4, 6, 4, 2, 0,
+	14, 2, 0, 14, 2, 0, 14, 4, 0, 4, 6, 4, 4, 0, 4, 6,
+	4, 4, 0, 4, 6, 4, 4, 0, 4, 6, 4, 4, 0, 4, 6, 4,
+	4, 0, 4, 6, 4, 4, 0, 4, 6, 4, 4, 0, 4, 6, 4, 2,
+	0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0,
+	4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4,
+	2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2,
+	0, 4, 2, 0, 4, 2, 7, 4, 2, 7, 4, 2, 7, 4, 2, 7,
+	4, 2, 7, 4, 2, 7, 4, 2, 7, 4, 2, 7, 4, 2, 7, 4,
+	2, 7, 4, 2, 7, 4, 4, 0, 4, 3, 4, 4, 0, 4, 3, 4,
+	4, 0, 4, 3, 4, 4, 0, 4, 3, 4, 3, 1, 9, 1, 3, 1,
+	9, 1, 3, 3, 5, 3, 5, 0, 4, 6, 5, 1, 5, 0, 4, 6,
+	4, 2, 5, 0, 4, 5, 4, 3, 5, 0, 4, 4, 4, 4, 5, 0,
+	4, 3, 4, 5, 5, 0, 4, 2, 4, 6, 5, 0, 4, 1, 4, 7,
+	3, 0, 8, 8, 3, 0, 9, 7, 3, 0, 9, 7, 5, 0, 5, 1,
+	4, 6, 5, 0, 4, 3, 4, 5, 5, 0, 4, 4, 4, 4, 5, 0,
+	4, 4, 4, 4, 5, 0, 4, 5, 4, 3, 5, 0, 4, 6, 4, 2,
+	5, 0, 4, 6, 5, 1, 5, 0, 4, 7, 4, 1, 3, 0, 4, 7,
+	3, 0, 4, 7, 3, 0, 4, 7, 3, 0, 4, 7, 3, 0, 4, 7,
+	3, 0, 4, 7, 3, 0, 4, 7, 3, 0, 4, 7, 3, 0, 4, 7,
+	3, 0, 4, 7, 3, 0, 4, 7, 3, 0, 4, 7, 3, 0, 4, 7,
+	3, 0, 4, 7, 3, 0, 4, 7, 2, 0, 11, 2, 0, 11, 2, 0,
+	11, 4, 0, 5, 6, 6, 4, 0, 6, 5, 6, 4, 0, 6, 4, 7,
+	4, 0, 6, 4, 7, 4, 0, 6, 4, 7, 4, 0, 6, 4, 7, 4,
+	0, 7, 2, 8, 6, 0, 7, 2, 3, 1, 4, 6, 0, 7, 2, 3,
+	1, 4, 8, 0, 4, 1, 2, 2, 3, 1, 4, 8, 0, 4, 1, 3,
+	1, 3, 1, 4, 6, 0, 4, 1, 6, 2, 4, 6, 0, 4, 1, 6,
+	2, 4, 6, 0, 4, 2, 5, 2, 4, 6, 0, 4, 2, 5, 2, 4,
+	6, 0, 4, 2, 4, 3, 4, 6, 0, 4, 2, 4, 3, 4, 6, 0,
+	4, 3, 3, 3, 4, 4, 0, 4, 7, 4, 4, 0, 5, 6, 4, 4,
+	0, 6, 5, 4, 4, 0, 6, 5, 4, 4, 0, 7, 4, 4, 4, 0,
+	7, 4, 4, 6, 0, 4, 1, 3, 3, 4, 6, 0, 4, 1, 3, 3,
+	4, 6, 0, 4, 2, 3, 2, 4, 6, 0, 4, 2, 3, 2, 4, 6,
+	0, 4, 3, 3, 1, 4, 4, 0, 4, 3, 8, 4, 0, 4, 4, 7,
+	4, 0, 4, 4, 7, 4, 0, 4, 5, 6, 4, 0, 4, 6, 5, 4,
+	0, 4, 6, 5, 4, 0, 4, 7, 4, 3, 6, 5, 6, 3, 3, 10,
+	4, 3, 2, 13, 2, 5, 2, 5, 3, 5, 2, 5, 1, 4, 7, 4,
+	1, 5, 1, 4, 7, 4, 1, 4, 0, 4, 9, 4, 4, 0, 4, 9,
+	4, 4, 0, 4, 9, 4, 4, 0, 4, 9, 4, 4, 0, 4, 9, 4,
+	4, 0, 4, 9, 4, 5, 1, 4, 7, 4, 1, 5, 1, 4, 7, 4,
+	1, 5, 2, 4, 4, 5, 2, 3, 2, 13, 2, 3, 3, 11, 3, 3,
+	5, 7, 5, 3, 0, 11, 3, 3, 0, 13, 1, 3, 0, 13, 1, 4,
+	0, 4, 5, 5, 4, 0, 4, 6, 4, 4, 0, 4, 6, 4, 4, 0,
+	4, 6, 4, 4, 0, 4, 5, 5, 3, 0, 13, 1, 3, 0, 12, 2,
+	3, 0, 11, 3, 3, 0, 4, 10, 3, 0, 4, 10, 3, 0, 4, 10,
+	3, 0, 4, 10, 3, 0, 4, 10, 3, 0, 4, 10, 3, 0, 4, 10,
+	3, 6, 5, 6, 3, 3, 10, 4, 3, 2, 13, 2, 5, 2, 5, 3,
+	5, 2, 5, 1, 4, 7, 4, 1, 5, 1, 4, 7, 4, 1, 4, 0,
+	4, 9, 4, 4, 0, 4, 9, 4, 4, 0, 4, 9, 4, 4, 0, 4,
+	9, 4, 4, 0, 4, 9, 4, 6, 0, 4, 6, 1, 2, 4, 5, 1,
+	4, 4, 7, 1, 5, 1, 4, 4, 7, 1, 5, 2, 4, 4, 5, 2,
+	3, 2, 13, 2, 2, 3, 14, 5, 5, 6, 3, 2, 1, 1, 17, 3,
+	0, 13, 3, 3, 0, 14, 2, 3, 0, 14, 2, 5, 0, 4, 6, 5,
+	1, 5, 0, 4, 7, 4, 1, 5, 0, 4, 7, 4, 1, 5, 0, 4,
+	7, 4, 1, 5, 0, 4, 6, 4, 2, 3, 0, 13, 3, 3, 0, 12,
+	4, 3, 0, 13, 3, 5, 0, 4, 6, 4, 2, 5, 0, 4, 6, 4,
+	2, 5, 0, 4, 6, 4, 2, 5, 0, 4, 6, 4, 2, 5, 0, 4,
+	6, 4, 2, 5, 0, 4, 6, 4, 2, 4, 0, 4, 7, 5, 3, 4,
+	6, 5, 3, 2, 10, 3, 3, 1, 12, 2, 5, 0, 5, 4, 5, 1,
+	5, 0, 4, 6, 4, 1, 3, 0, 4, 11, 3, 0, 4, 11, 3, 0,
+	7, 8, 3, 1, 11, 3, 3, 3, 11, 1, 2, 6, 9, 2, 10, 5,
+	2, 11, 4, 4, 0, 4, 7, 4, 4, 1, 4, 5, 5, 3, 1, 13,
+	1, 3, 2, 11, 2, 3, 4, 7, 4, 2, 0, 12, 2, 0, 12, 2,
+	0, 12, 3, 4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 4,
+	4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 4,
+	4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 4,
+	4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 4, 0,
+	4, 6, 4, 4, 0, 4, 6, 4, 4, 0, 4, 6, 4, 4, 0, 4,
+	6, 4, 4, 0, 4, 6, 4, 4, 0, 4, 6, 4, 4, 0, 4, 6,
+	4, 4, 0, 4, 6, 4, 4, 0, 4, 6, 4, 4, 0, 4, 6, 4,
+	4, 0, 4, 6, 4, 4, 0, 4, 6, 4, 4, 0, 4, 6, 4, 4,
+	0, 4, 6, 4, 5, 1, 4, 4, 4, 1, 3, 1, 12, 1, 3, 2,
+	10, 2, 3, 4, 6, 4, 4, 1, 3, 8, 3, 4, 1, 4, 6, 4,
+	4, 1, 4, 6, 4, 5, 2, 3, 6, 3, 1, 5, 2, 3, 6, 3,
+	1, 5, 2, 4, 4, 4, 1, 5, 3, 3, 4, 3, 2, 5, 3, 3,
+	4, 3, 2, 5, 3, 4, 2, 4, 2, 5, 4, 3, 2, 3, 3, 5,
+	4, 3, 2, 3, 3, 5, 4, 3, 2, 3, 3, 3, 5, 6, 4, 3,
+	5, 6, 4, 3, 5, 6, 4, 3, 6, 4, 5, 3, 6, 4, 5, 3,
+	6, 4, 5, 7, 1, 3, 6, 3, 6, 3, 1, 7, 1, 3, 5, 4,
+	5, 4, 1, 7, 1, 4, 4, 5, 4, 4, 1, 7, 1, 4, 4, 5,
+	4, 4, 1, 7, 2, 3, 4, 5, 4, 3, 2, 7, 2, 3, 4, 5,
+	4, 3, 2, 9, 2, 3, 3, 3, 1, 3, 2, 4, 2, 9, 2, 4,
+	2, 3, 1, 3, 2, 3, 3, 9, 3, 3, 2, 3, 1, 3, 2, 3,
+	3, 9, 3, 3, 2, 3, 2, 2, 2, 3, 3, 9, 3, 3, 2, 3,
+	2, 2, 2, 3, 3, 7, 4, 2, 1, 3, 3, 6, 4, 5, 4, 6,
+	3, 6, 4, 5, 4, 6, 3, 6, 4, 5, 4, 6, 4, 5, 4, 5,
+	5, 5, 4, 4, 5, 5, 5, 4, 5, 4, 5, 5, 5, 4, 5, 4,
+	5, 5, 0, 4, 6, 4, 1, 5, 1, 4, 4, 5, 1, 5, 1, 4,
+	4, 4, 2, 5, 2, 4, 2, 4, 3, 5, 2, 4, 2, 4, 3, 3,
+	3, 8, 4, 3, 4, 6, 5, 3, 4, 6, 5, 3, 5, 4, 6, 3,
+	5, 4, 6, 3, 4, 6, 5, 3, 3, 8, 4, 3, 3, 8, 4, 5,
+	2, 4, 2, 4, 3, 5, 2, 4, 3, 4, 2, 5, 1, 4, 4, 4,
+	2, 5, 0, 5, 5, 4, 1, 5, 0, 4, 6, 4, 1, 5, 0, 4,
+	7, 4, 1, 5, 1, 4, 6, 4, 1, 5, 1, 4, 5, 4, 2, 5,
+	2, 4, 4, 4, 2, 5, 2, 4, 3, 4, 3, 5, 3, 4, 2, 4,
+	3, 5, 4, 3, 2, 3, 4, 3, 4, 8, 4, 3, 5, 6, 5, 3,
+	5, 6, 5, 3, 6, 4, 6, 3, 6, 4, 6, 3, 6, 4, 6, 3,
+	6, 4, 6, 3, 6, 4, 6, 3, 6, 4, 6, 3, 6, 4, 6, 3,
+	6, 4, 6, 2, 0, 13, 2, 0, 13, 2, 0, 13, 2, 8, 5, 3,
+	8, 4, 1, 3, 7, 4, 2, 3, 6, 4, 3, 3, 5, 5, 3, 3,
+	5, 4, 4, 3, 4, 4, 5, 3, 3, 4, 6, 3, 2, 5, 6, 3,
+	2, 4, 7, 3, 1, 4, 8, 3, 0, 4, 9, 2, 0, 13, 2, 0,
+	13, 2, 0, 13, 2, 0, 6, 2, 0, 6, 2, 0, 6, 3, 0, 4,
+	2, 3, 0, 4, 2, 3, 0, 4, 2, 3, 0, 4, 2, 3, 0, 4,
+	2, 3, 0, 4, 2, 3, 0, 4, 2, 3, 0, 4, 2, 3, 0, 4,
+	2, 3, 0, 4, 2, 3, 0, 4, 2, 3, 0, 4, 2, 3, 0, 4,
+	2, 3, 0, 4, 2, 3, 0, 4, 2, 3, 0, 4, 2, 3, 0, 4,
+	2, 2, 0, 6, 2, 0, 6, 2, 0, 6, 3, 0, 2, 5, 3, 0,
+	2, 5, 3, 1, 1, 5, 3, 1, 2, 4, 3, 1, 2, 4, 3, 2,
+	1, 4, 3, 2, 2, 3, 3, 2, 2, 3, 3, 3, 1, 3, 3, 3,
+	2, 2, 3, 3, 2, 2, 3, 4, 1, 2, 3, 4, 2, 1, 3, 4,
+	2, 1, 3, 5, 1, 1, 2, 5, 2, 2, 5, 2, 2, 0, 6, 2,
+	0, 6, 2, 0, 6, 2, 2, 4, 2, 2, 4, 2, 2, 4, 2, 2,
+	4, 2, 2, 4, 2, 2, 4, 2, 2, 4, 2, 2, 4, 2, 2, 4,
+	2, 2, 4, 2, 2, 4, 2, 2, 4, 2, 2, 4, 2, 2, 4, 2,
+	2, 4, 2, 2, 4, 2, 2, 4, 2, 0, 6, 2, 0, 6, 2, 0,
+	6, 3, 4, 4, 4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 3, 6,
+	3, 5, 3, 2, 1, 3, 3, 5, 2, 3, 2, 3, 2, 5, 2, 3,
+	2, 3, 2, 5, 2, 2, 4, 2, 2, 5, 1, 3, 4, 3, 1, 5,
+	1, 3, 4, 3, 1, 4, 0, 3, 6, 3, 2, 0, 15, 2, 0, 15,
+	3, 0, 3, 1, 3, 1, 2, 1, 2, 2, 2, 3, 3, 6, 4, 3,
+	1, 10, 2, 3, 1, 11, 1, 5, 0, 4, 4, 4, 1, 3, 8, 4,
+	1, 3, 5, 7, 1, 3, 1, 11, 1, 5, 0, 5, 3, 4, 1, 5,
+	0, 4, 4, 4, 1, 5, 0, 4, 3, 5, 1, 3, 0, 12, 1, 3,
+	1, 11, 1, 4, 2, 4, 2, 5, 3, 0, 4, 9, 3, 0, 4, 9,
+	3, 0, 4, 9, 3, 0, 4, 9, 3, 0, 4, 9, 5, 0, 4, 1,
+	4, 4, 3, 0, 11, 2, 3, 0, 12, 1, 5, 0, 5, 3, 4, 1,
+	4, 0, 4, 5, 4, 4, 0, 4, 5, 4, 4, 0, 4, 5, 4, 4,
+	0, 4, 5, 4, 4, 0, 4, 5, 4, 5, 0, 5, 3, 4, 1, 3,
+	0, 12, 1, 3, 0, 11, 2, 5, 0, 4, 1, 5, 3, 3, 4, 5,
+	3, 3, 2, 9, 1, 2, 1, 11, 4, 1, 4, 3, 4, 4, 0, 4,
+	5, 3, 3, 0, 4, 8, 3, 0, 4, 8, 3, 0, 4, 8, 4, 0,
+	4, 5, 3, 4, 1, 4, 3, 4, 2, 1, 11, 3, 2, 9, 1, 3,
+	4, 5, 3, 2, 9, 4, 2, 9, 4, 2, 9, 4, 2, 9, 4, 2,
+	9, 4, 4, 3, 5, 1, 4, 2, 2, 11, 2, 1, 12, 4, 1, 4,
+	3, 5, 4, 0, 4, 5, 4, 4, 0, 4, 5, 4, 4, 0, 4, 5,
+	4, 4, 0, 4, 5, 4, 4, 0, 4, 5, 4, 4, 1, 4, 3, 5,
+	2, 1, 12, 2, 2, 11, 4, 3, 5, 1, 4, 3, 3, 6, 4, 3,
+	2, 8, 3, 3, 1, 10, 2, 5, 0, 5, 3, 3, 2, 5, 0, 4,
+	5, 3, 1, 3, 0, 12, 1, 3, 0, 12, 1, 3, 0, 4, 9, 3,
+	0, 4, 9, 5, 1, 4, 4, 3, 1, 3, 1, 11, 1, 3, 2, 9,
+	2, 3, 4, 5, 4, 2, 2, 5, 2, 1, 6, 2, 1, 6, 3, 1,
+	4, 2, 3, 1, 4, 2, 3, 0, 6, 1, 3, 0, 6, 1, 3, 1,
+	4, 2, 3, 1, 4, 2, 3, 1, 4, 2, 3, 1, 4, 2, 3, 1,
+	4, 2, 3, 1, 4, 2, 3, 1, 4, 2, 3, 1, 4, 2, 3, 1,
+	4, 2, 3, 1, 4, 2, 3, 1, 4, 2, 4, 3, 4, 2, 4, 4,
+	2, 6, 1, 4, 2, 1, 12, 4, 1, 4, 3, 5, 4, 0, 4, 5,
+	4, 4, 0, 4, 5, 4, 4, 0, 4, 5, 4, 4, 0, 4, 5, 4,
+	4, 0, 4, 5, 4, 4, 0, 5, 3, 5, 2, 1, 12, 2, 2, 11,
+	4, 3, 5, 1, 4, 2, 9, 4, 2, 9, 4, 5, 0, 5, 3, 4,
+	1, 3, 1, 11, 1, 3, 3, 7, 3, 3, 0, 4, 8, 3, 0, 4,
+	8, 3, 0, 4, 8, 3, 0, 4, 8, 3, 0, 4, 8, 5, 0, 4,
+	1, 5, 2, 3, 0, 11, 1, 2, 0, 12, 4, 0, 5, 2, 5, 4,
+	0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 0,
+	4, 4, 4, 4, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 0, 4,
+	4, 4, 4, 0, 4, 4, 4, 4, 0, 4, 4, 4, 2, 0, 4, 2,
+	0, 4, 2, 0, 4, 1, 4, 1, 4, 2, 0, 4, 2, 0, 4, 2,
+	0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0,
+	4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4,
+	2, 2, 4, 2, 2, 4, 2, 2, 4, 1, 6, 1, 6, 2, 2, 4,
+	2, 2, 4, 2, 2, 4, 2, 2, 4, 2, 2, 4, 2, 2, 4, 2,
+	2, 4, 2, 2, 4, 2, 2, 4, 2, 2, 4, 2, 2, 4, 2, 2,
+	4, 2, 2, 4, 2, 2, 4, 2, 2, 4, 2, 0, 6, 2, 0, 6,
+	3, 0, 5, 1, 3, 0, 4, 8, 3, 0, 4, 8, 3, 0, 4, 8,
+	3, 0, 4, 8, 3, 0, 4, 8, 4, 0, 4, 4, 4, 5, 0, 4,
+	3, 4, 1, 5, 0, 4, 2, 4, 2, 5, 0, 4, 1, 4, 3, 3,
+	0, 8, 4, 3, 0, 8, 4, 3, 0, 9, 3, 3, 0, 9, 3, 5,
+	0, 4, 2, 4, 2, 5, 0, 4, 3, 3, 2, 5, 0, 4, 3, 4,
+	1, 5, 0, 4, 4, 3, 1, 4, 0, 4, 4, 4, 2, 0, 4, 2,
+	0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0,
+	4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4,
+	2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2,
+	0, 4, 7, 0, 4, 1, 4, 3, 5, 2, 5, 0, 10, 1, 7, 1,
+	2, 0, 19, 6, 0, 5, 2, 5, 3, 4, 6, 0, 4, 3, 4, 4,
+	4, 6, 0, 4, 3, 4, 4, 4, 6, 0, 4, 3, 4, 4, 4, 6,
+	0, 4, 3, 4, 4, 4, 6, 0, 4, 3, 4, 4, 4, 6, 0, 4,
+	3, 4, 4, 4, 6, 0, 4, 3, 4, 4, 4, 6, 0, 4, 3, 4,
+	4, 4, 6, 0, 4, 3, 4, 4, 4, 5, 0, 4, 1, 5, 2, 3,
+	0, 11, 1, 2, 0, 12, 4, 0, 5, 2, 5, 4, 0, 4, 4, 4,
+	4, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4,
+	0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 0,
+	4, 4, 4, 4, 0, 4, 4, 4, 3, 4, 5, 4, 3, 2, 9, 2,
+	3, 1, 11, 1, 5, 1, 4, 3, 4, 1, 4, 0, 4, 5, 4, 4,
+	0, 4, 5, 4, 4, 0, 4, 5, 4, 4, 0, 4, 5, 4, 4, 0,
+	4, 5, 4, 5, 1, 4, 3, 4, 1, 3, 1, 11, 1, 3, 2, 9,
+	2, 3, 4, 5, 4, 5, 0, 4, 1, 5, 3, 3, 0, 11, 2, 3,
+	0, 12, 1, 5, 0, 5, 3, 4, 1, 4, 0, 4, 5, 4, 4, 0,
+	4, 5, 4, 4, 0, 4, 5, 4, 4, 0, 4, 5, 4, 4, 0, 4,
+	5, 4, 5, 0, 5, 3, 4, 1, 3, 0, 12, 1, 3, 0, 11, 2,
+	5, 0, 4, 1, 4, 4, 3, 0, 4, 9, 3, 0, 4, 9, 3, 0,
+	4, 9, 3, 0, 4, 9, 3, 0, 4, 9, 4, 4, 4, 1, 4, 2,
+	2, 11, 2, 1, 12, 4, 1, 4, 3, 5, 4, 0, 4, 5, 4, 4,
+	0, 4, 5, 4, 4, 0, 4, 5, 4, 4, 0, 4, 5, 4, 4, 0,
+	4, 5, 4, 4, 1, 4, 3, 5, 2, 1, 12, 2, 2, 11, 4, 3,
+	5, 1, 4, 2, 9, 4, 2, 9, 4, 2, 9, 4, 2, 9, 4, 2,
+	9, 4, 4, 0, 4, 2, 2, 4, 0, 4, 1, 3, 2, 0, 8, 3,
+	0, 5, 3, 3, 0, 4, 4, 3, 0, 4, 4, 3, 0, 4, 4, 3,
+	0, 4, 4, 3, 0, 4, 4, 3, 0, 4, 4, 3, 0, 4, 4, 3,
+	0, 4, 4, 3, 0, 4, 4, 3, 3, 6, 3, 3, 1, 9, 2, 3,
+	0, 11, 1, 4, 0, 4, 4, 4, 3, 0, 5, 7, 3, 0, 8, 4,
+	3, 1, 10, 1, 2, 4, 8, 2, 7, 5, 4, 0, 4, 4, 4, 3,
+	0, 11, 1, 3, 1, 10, 1, 3, 3, 6, 3, 3, 1, 4, 1, 3,
+	1, 4, 1, 3, 1, 4, 1, 2, 0, 6, 2, 0, 6, 3, 1, 4,
+	1, 3, 1, 4, 1, 3, 1, 4, 1, 3, 1, 4, 1, 3, 1, 4,
+	1, 3, 1, 4, 1, 3, 1, 4, 1, 2, 1, 5, 2, 1, 5, 2,
+	2, 4, 4, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 0, 4, 4,
+	4, 4, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 0, 4, 4, 4,
+	4, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4,
+	0, 4, 3, 5, 2, 0, 12, 2, 1, 11, 4, 2, 5, 1, 4, 4,
+	0, 4, 5, 4, 5, 1, 3, 5, 3, 1, 5, 1, 4, 4, 3, 1,
+	5, 1, 4, 3, 4, 1, 5, 2, 3, 3, 3, 2, 5, 2, 3, 3,
+	3, 2, 5, 3, 3, 1, 4, 2, 5, 3, 3, 1, 3, 3, 5, 3,
+	3, 1, 3, 3, 3, 4, 6, 3, 3, 4, 5, 4, 3, 4, 5, 4,
+	3, 5, 3, 5, 6, 0, 4, 4, 3, 4, 3, 6, 1, 3, 3, 4,
+	4, 3, 6, 1, 3, 3, 5, 2, 4, 6, 1, 4, 2, 5, 2, 4,
+	9, 1, 4, 2, 2, 1, 2, 2, 3, 1, 9, 2, 3, 2, 2, 1,
+	2, 2, 3, 1, 9, 2, 3, 1, 3, 1, 2, 2, 3, 1, 7, 2,
+	3, 1, 3, 1, 6, 2, 5, 3, 5, 2, 6, 2, 5, 3, 5, 3,
+	5, 2, 5, 3, 5, 3, 5, 2, 5, 3, 5, 3, 4, 3, 5, 4,
+	3, 4, 4, 3, 5, 1, 4, 3, 4, 1, 5, 1, 4, 3, 4, 1,
+	5, 2, 4, 1, 4, 2, 5, 3, 3, 1, 3, 3, 3, 3, 7, 3,
+	3, 4, 5, 4, 3, 5, 4, 4, 3, 4, 5, 4, 3, 3, 7, 3,
+	5, 3, 3, 1, 4, 2, 5, 2, 4, 1, 4, 2, 5, 1, 4, 3,
+	4, 1, 5, 1, 4, 4, 3, 1, 4, 0, 4, 5, 4, 5, 1, 3,
+	5, 3, 1, 5, 1, 4, 4, 3, 1, 5, 2, 3, 3, 4, 1, 5,
+	2, 3, 3, 3, 2, 5, 2, 4, 2, 3, 2, 5, 3, 3, 2, 3,
+	2, 5, 3, 3, 1, 3, 3, 3, 3, 7, 3, 3, 4, 6, 3, 3,
+	4, 5, 4, 3, 5, 4, 4, 3, 5, 3, 5, 3, 5, 3, 5, 3,
+	4, 4, 5, 3, 2, 5, 6, 3, 2, 5, 6, 3, 2, 4, 7, 2,
+	0, 10, 2, 0, 10, 2, 0, 10, 2, 6, 4, 3, 5, 4, 1, 3,
+	4, 4, 2, 3, 3, 4, 3, 3, 2, 4, 4, 3, 1, 4, 5, 3,
+	0, 4, 6, 2, 0, 10, 2, 0, 10, 2, 0, 10, 2, 3, 3, 2,
+	2, 4, 2, 2, 4, 3, 2, 3, 1, 3, 2, 3, 1, 3, 2, 3,
+	1, 3, 2, 3, 1, 3, 2, 3, 1, 3, 2, 3, 1, 3, 2, 3,
+	1, 3, 2, 3, 1, 3, 0, 4, 2, 3, 0, 4, 2, 3, 2, 3,
+	1, 3, 2, 3, 1, 3, 2, 3, 1, 3, 2, 3, 1, 3, 2, 3,
+	1, 3, 2, 3, 1, 3, 2, 3, 1, 2, 2, 4, 2, 2, 4, 2,
+	3, 3, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0,
+	2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2,
+	2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2,
+	0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0,
+	2, 2, 0, 2, 3, 0, 3, 3, 3, 0, 3, 3, 3, 0, 4, 2,
+	3, 1, 3, 2, 3, 1, 3, 2, 3, 1, 3, 2, 3, 1, 3, 2,
+	3, 1, 3, 2, 3, 1, 3, 2, 3, 1, 3, 2, 3, 1, 3, 2,
+	2, 2, 4, 2, 2, 4, 3, 1, 3, 2, 3, 1, 3, 2, 3, 1,
+	3, 2, 3, 1, 3, 2, 3, 1, 3, 2, 3, 1, 3, 2, 3, 1,
+	3, 2, 3, 0, 4, 2, 3, 0, 4, 2, 3, 0, 3, 3, 3, 1,
+	4, 7, 3, 0, 7, 5, 6, 0, 2, 2, 4, 2, 2, 2, 5, 7,
+	3, 7, 4, 1,
+};
+
+const uint16_t FreeSansBold12pt7bSpanOffsets[] = {		// 0x20 .. 0x7E
+	0, 0, 54, 86, 167, 267, 378, 468, 488, 573, 653, 691, 732, 755, 764, 773,
+	839, 920, 971, 1037, 1109, 1186, 1255, 1332, 1397, 1479, 1556, 1586, 1630, 1672, 1696, 1739,
+	1810, 1958, 2047, 2133, 2213, 2301, 2370, 2439, 2523, 2607, 2661, 2726, 2828, 2897, 3013, 3113,
+	3203, 3280, 3375, 3470, 3545, 3614, 3702, 3795, 3937, 4029, 4115, 4180, 4266, 4332, 4401, 4458,
+	4464, 4475, 4536, 4621, 4675, 4747, 4805, 4874, 4953, 5036, 5088, 5156, 5244, 5298, 5385, 5448,
+	5509, 5594, 5666, 5719, 5771, 5826, 5887, 5956, 6052, 6120, 6207, 6252, 6338, 6404, 6494,
+};
+
+const uint8_t FreeSansBold12pt7bAdvances[] = {		// 0x20 .. 0x7E
+	7, 8, 11, 13, 13, 21, 17, 6, 8, 8, 9, 14, 6, 8, 6, 7,
+	13, 14, 13, 13, 13, 13, 13, 13, 13, 13, 6, 6, 14, 14, 14, 15,
+	23, 17, 17, 17, 17, 16, 15, 18, 18, 7, 14, 17, 15, 21, 18, 19,
+	16, 19, 17, 16, 15, 18, 16, 23, 16, 15, 15, 8, 7, 8, 14, 13,
+	6, 14, 15, 13, 15, 14, 8, 15, 14, 7, 7, 14, 6, 21, 15, 15,
+	15, 15, 9, 13, 8, 15, 13, 19, 13, 13, 12, 9, 7, 9, 12,
+};
+
+const GFXmetrics FreeSansBold12pt7bMetrics = {
+	-17, 6, 24, 23, FreeSansBold12pt7bAdvances
+};
+
+// Approx. 6809 bytes
+
+#endif /* __FREESANSBOLD12PT7B_RENDER_H_ */
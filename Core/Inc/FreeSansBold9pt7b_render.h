@@ -0,0 +1,337 @@
+// Generated by Tools/fontspans.py from FreeSansBold9pt7b.h - do not edit
+
+#ifndef __FREESANSBOLD9PT7B_RENDER_H_
+#define __FREESANSBOLD9PT7B_RENDER_H_
+
+#include "gfxfont.h"
+
+const uint8_t FreeSansBold9pt7bSpans[] = {
+	2, 0, 3, 2, 0, 3, 2, 0, 3, 2, 0, 3, 2, 0, 3, 2,
+	0, 3, 2, 0, 3, 3, 0, 2, 1, 3, 1, 1, 1, 3, 1, 1,
+	1, 1, 3, 2, 0, 3, 2, 0, 3, 4, 0, 3, 1, 3, 4, 0,
+	3, 1, 3, 4, 0, 3, 1, 3, 4, 0, 3, 1, 3, 5, 1, 1,
+	3, 1, 1, 5, 3, 2, 2, 2, 1, 5, 3, 2, 2, 2, 1, 2,
+	1, 9, 2, 1, 9, 5, 2, 2, 2, 2, 2, 5, 2, 2, 2, 2,
+	2, 5, 2, 2, 2, 2, 2, 3, 0, 9, 1, 3, 0, 9, 1, 5,
+	1, 2, 2, 2, 3, 5, 1, 2, 2, 2, 3, 5, 1, 2, 2, 1,
+	4, 3, 3, 1, 5, 3, 2, 5, 2, 3, 1, 7, 1, 4, 0, 4,
+	1, 4, 4, 0, 4, 2, 3, 3, 0, 4, 5, 3, 0, 4, 5, 3,
+	1, 6, 2, 3, 3, 5, 1, 4, 3, 1, 2, 3, 4, 0, 4, 2,
+	3, 4, 0, 4, 1, 4, 3, 1, 7, 1, 3, 2, 4, 3, 3, 3,
+	1, 5, 5, 2, 3, 6, 1, 4, 5, 1, 5, 4, 2, 4, 7, 0,
+	2, 3, 2, 3, 1, 5, 7, 0, 2, 3, 2, 2, 1, 6, 7, 0,
+	2, 3, 2, 2, 1, 6, 5, 1, 5, 2, 1, 7, 7, 2, 3, 2,
+	2, 2, 3, 2, 5, 7, 1, 2, 5, 1, 6, 6, 2, 1, 2, 3,
+	2, 6, 6, 1, 2, 2, 3, 2, 6, 5, 1, 3, 2, 3, 2, 5,
+	4, 2, 4, 5, 1, 5, 4, 1, 6, 3, 2, 3, 4, 3, 5, 3,
+	3, 6, 3, 5, 2, 3, 1, 3, 3, 5, 2, 3, 1, 3, 3, 3,
+	2, 6, 4, 3, 3, 4, 5, 5, 2, 5, 2, 2, 1, 7, 1, 3,
+	1, 3, 1, 2, 1, 5, 0, 3, 3, 5, 1, 5, 0, 3, 4, 3,
+	2, 5, 0, 4, 2, 4, 2, 3, 1, 10, 1, 4, 2, 6, 1, 3,
+	2, 0, 3, 2, 0, 3, 2, 0, 3, 2, 0, 3, 3, 1, 1, 1,
+	3, 3, 2, 1, 3, 3, 2, 1, 3, 2, 2, 2, 3, 1, 3, 2,
+	3, 1, 3, 2, 3, 0, 3, 3, 3, 0, 3, 3, 3, 0, 3, 3,
+	3, 0, 3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 3, 1, 2, 3,
+	3, 1, 3, 2, 3, 2, 2, 2, 3, 2, 2, 2, 3, 3, 2, 1,
+	3, 4, 1, 1, 3, 1, 2, 3, 3, 1, 2, 3, 3, 2, 2, 2,
+	3, 2, 3, 1, 3, 2, 3, 1, 2, 3, 3, 2, 3, 3, 2, 3,
+	3, 2, 3, 3, 2, 3, 3, 2, 3, 3, 3, 3, 2, 1, 3, 2,
+	3, 1, 3, 2, 3, 1, 3, 2, 2, 2, 3, 1, 2, 3, 3, 1,
+	1, 4, 3, 2, 1, 2, 3, 2, 1, 2, 2, 0, 5, 3, 2, 1,
+	2, 5, 1, 1, 1, 1, 1, 5, 1, 1, 1, 1, 1, 3, 2, 3,
+	2, 3, 2, 3, 2, 3, 2, 3, 2, 2, 0, 7, 2, 0, 7, 3,
+	2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 2, 0, 3, 2, 0,
+	3, 2, 2, 1, 2, 2, 1, 3, 0, 2, 1, 2, 0, 5, 2, 0,
+	5, 2, 0, 3, 2, 0, 3, 2, 4, 1, 2, 3, 2, 3, 3, 1,
+	1, 3, 3, 1, 1, 3, 2, 2, 1, 3, 2, 1, 2, 3, 2, 1,
+	2, 3, 2, 1, 2, 3, 1, 2, 2, 3, 1, 1, 3, 3, 1, 1,
+	3, 3, 0, 2, 3, 3, 0, 1, 4, 3, 2, 5, 2, 3, 1, 7,
+	1, 5, 1, 3, 1, 3, 1, 4, 0, 3, 3, 3, 4, 0, 3, 3,
+	3, 4, 0, 3, 3, 3, 4, 0, 3, 3, 3, 4, 0, 3, 3, 3,
+	4, 0, 3, 3, 3, 4, 0, 3, 3, 3, 5, 1, 3, 1, 3, 1,
+	3, 1, 7, 1, 3, 2, 5, 2, 2, 4, 1, 2, 3, 2, 2, 0,
+	5, 2, 0, 5, 2, 2, 3, 2, 2, 3, 2, 2, 3, 2, 2, 3,
+	2, 2, 3, 2, 2, 3, 2, 2, 3, 2, 2, 3, 2, 2, 3, 3,
+	2, 5, 2, 3, 1, 7, 1, 4, 0, 3, 3, 3, 4, 0, 3, 3,
+	3, 2, 6, 3, 2, 6, 3, 3, 5, 3, 1, 3, 4, 3, 2, 3,
+	3, 3, 3, 3, 2, 3, 4, 3, 1, 3, 5, 2, 1, 8, 2, 1,
+	8, 3, 2, 4, 2, 2, 1, 7, 4, 0, 3, 2, 3, 4, 0, 3,
+	2, 3, 2, 5, 3, 3, 4, 2, 2, 3, 4, 3, 1, 2, 5, 3,
+	2, 5, 3, 4, 0, 3, 2, 3, 4, 0, 3, 2, 3, 3, 1, 6,
+	1, 3, 2, 4, 2, 3, 4, 3, 1, 3, 3, 4, 1, 3, 3, 4,
+	1, 5, 2, 1, 1, 3, 1, 5, 2, 1, 1, 3, 1, 5, 1, 1,
+	2, 3, 1, 5, 1, 1, 2, 3, 1, 5, 0, 1, 3, 3, 1, 2,
+	0, 8, 2, 0, 8, 3, 4, 3, 1, 3, 4, 3, 1, 3, 4, 3,
+	1, 3, 1, 7, 1, 3, 1, 7, 1, 3, 1, 1, 7, 3, 0, 2,
+	7, 5, 0, 2, 1, 4, 2, 3, 0, 8, 1, 4, 0, 3, 2, 4,
+	2, 6, 3, 2, 6, 3, 2, 6, 3, 4, 0, 2, 3, 4, 3, 0,
+	8, 1, 3, 1, 5, 3, 3, 2, 5, 2, 3, 1, 7, 1, 4, 1,
+	3, 2, 3, 3, 0, 3, 6, 5, 0, 3, 1, 3, 2, 3, 0, 8,
+	1, 4, 0, 4, 1, 4, 4, 0, 3, 3, 3, 4, 0, 3, 3, 3,
+	4, 0, 3, 3, 3, 4, 1, 3, 1, 4, 3, 1, 7, 1, 3, 2,
+	5, 2, 2, 0, 9, 2, 0, 9, 2, 6, 3, 3, 5, 3, 1, 3,
+	5, 2, 2, 3, 4, 3, 2, 3, 4, 2, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 2, 4, 3, 2, 3, 4, 3, 2, 3, 4, 3,
+	2, 3, 4, 3, 2, 6, 2, 3, 1, 8, 1, 4, 0, 3, 3, 4,
+	4, 0, 3, 4, 3, 4, 0, 3, 3, 4, 3, 2, 6, 2, 3, 1,
+	8, 1, 4, 0, 4, 2, 4, 4, 0, 3, 4, 3, 4, 0, 3, 4,
+	3, 4, 0, 4, 2, 4, 3, 1, 8, 1, 3, 2, 6, 2, 3, 2,
+	5, 2, 3, 1, 7, 1, 5, 0, 4, 1, 3, 1, 4, 0, 3, 3,
+	3, 4, 0, 3, 3, 3, 4, 0, 3, 3, 3, 4, 0, 4, 1, 4,
+	2, 1, 8, 4, 2, 3, 1, 3, 2, 6, 3, 5, 0, 3, 2, 3,
+	1, 3, 1, 7, 1, 3, 2, 4, 3, 2, 0, 3, 2, 0, 3, 1,
+	3, 1, 3, 1, 3, 1, 3, 1, 3, 2, 0, 3, 2, 0, 3, 2,
+	0, 3, 2, 0, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 2,
+	0, 3, 2, 0, 3, 2, 2, 1, 2, 1, 2, 3, 0, 2, 1, 2,
+	8, 1, 2, 5, 4, 3, 3, 5, 1, 3, 0, 5, 4, 3, 0, 2,
+	7, 3, 0, 4, 5, 3, 2, 5, 2, 2, 4, 5, 2, 7, 2, 2,
+	0, 9, 2, 0, 9, 1, 9, 1, 9, 2, 0, 9, 2, 0, 9, 1,
+	9, 3, 0, 3, 6, 3, 0, 6, 3, 3, 3, 5, 1, 2, 6, 3,
+	2, 4, 5, 3, 1, 5, 3, 3, 0, 4, 5, 3, 0, 1, 8, 3,
+	2, 5, 2, 3, 1, 7, 1, 4, 0, 3, 3, 3, 4, 0, 3, 3,
+	3, 2, 6, 3, 2, 6, 3, 3, 5, 3, 1, 3, 4, 3, 2, 3,
+	3, 3, 3, 3, 3, 3, 3, 1, 9, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 6, 6, 4, 3, 4, 10, 2, 5, 3, 4, 5, 3, 1, 5,
+	2, 3, 9, 1, 1, 8, 1, 3, 4, 3, 1, 1, 2, 1, 8, 1,
+	2, 3, 2, 3, 2, 2, 1, 8, 0, 2, 4, 1, 4, 2, 2, 1,
+	8, 0, 2, 3, 2, 4, 1, 3, 1, 8, 0, 2, 3, 2, 3, 2,
+	2, 2, 9, 0, 2, 3, 2, 3, 2, 2, 1, 1, 5, 1, 2, 3,
+	9, 1, 7, 1, 3, 2, 4, 1, 3, 2, 3, 2, 4, 10, 3, 3,
+	10, 3, 3, 5, 7, 4, 3, 5, 3, 4, 3, 4, 4, 4, 3, 4,
+	5, 3, 3, 4, 5, 3, 5, 3, 3, 1, 2, 3, 5, 3, 2, 2,
+	3, 2, 5, 3, 2, 2, 3, 2, 5, 2, 3, 3, 2, 2, 3, 2,
+	9, 1, 3, 1, 10, 1, 5, 1, 3, 5, 2, 1, 4, 1, 2, 6,
+	3, 4, 0, 3, 6, 3, 3, 0, 9, 2, 3, 0, 10, 1, 4, 0,
+	3, 5, 3, 4, 0, 3, 5, 3, 4, 0, 3, 5, 3, 3, 0, 9,
+	2, 3, 0, 10, 1, 5, 0, 3, 5, 2, 1, 4, 0, 3, 5, 3,
+	4, 0, 3, 5, 3, 4, 0, 3, 5, 3, 3, 0, 10, 1, 3, 0,
+	9, 2, 3, 3, 6, 3, 3, 2, 9, 1, 5, 1, 4, 3, 3, 1,
+	4, 1, 3, 5, 3, 3, 0, 3, 9, 3, 0, 3, 9, 3, 0, 3,
+	9, 3, 0, 3, 9, 3, 0, 3, 9, 4, 1, 3, 5, 3, 4, 1,
+	4, 3, 4, 3, 2, 9, 1, 3, 3, 6, 3, 3, 0, 9, 3, 3,
+	0, 10, 2, 5, 0, 3, 5, 3, 1, 5, 0, 3, 5, 3, 1, 4,
+	0, 3, 6, 3, 4, 0, 3, 6, 3, 4, 0, 3, 6, 3, 4, 0,
+	3, 6, 3, 4, 0, 3, 6, 3, 5, 0, 3, 5, 3, 1, 5, 0,
+	3, 5, 3, 1, 3, 0, 10, 2, 3, 0, 9, 3, 2, 0, 9, 2,
+	0, 9, 3, 0, 3, 6, 3, 0, 3, 6, 3, 0, 3, 6, 3, 0,
+	8, 1, 3, 0, 8, 1, 3, 0, 3, 6, 3, 0, 3, 6, 3, 0,
+	3, 6, 3, 0, 3, 6, 2, 0, 9, 2, 0, 9, 2, 0, 9, 2,
+	0, 9, 3, 0, 3, 6, 3, 0, 3, 6, 3, 0, 3, 6, 3, 0,
+	8, 1, 3, 0, 8, 1, 3, 0, 3, 6, 3, 0, 3, 6, 3, 0,
+	3, 6, 3, 0, 3, 6, 3, 0, 3, 6, 3, 0, 3, 6, 3, 4,
+	5, 2, 3, 2, 8, 1, 4, 1, 4, 3, 3, 4, 1, 3, 5, 2,
+	3, 0, 3, 8, 3, 0, 3, 8, 4, 0, 3, 3, 5, 4, 0, 3,
+	3, 5, 4, 0, 3, 6, 2, 4, 1, 3, 5, 2, 4, 1, 4, 3,
+	3, 4, 2, 7, 1, 1, 4, 4, 4, 2, 1, 4, 0, 3, 5, 3,
+	4, 0, 3, 5, 3, 4, 0, 3, 5, 3, 4, 0, 3, 5, 3, 4,
+	0, 3, 5, 3, 2, 0, 11, 2, 0, 11, 4, 0, 3, 5, 3, 4,
+	0, 3, 5, 3, 4, 0, 3, 5, 3, 4, 0, 3, 5, 3, 4, 0,
+	3, 5, 3, 4, 0, 3, 5, 3, 2, 0, 3, 2, 0, 3, 2, 0,
+	3, 2, 0, 3, 2, 0, 3, 2, 0, 3, 2, 0, 3, 2, 0, 3,
+	2, 0, 3, 2, 0, 3, 2, 0, 3, 2, 0, 3, 2, 0, 3, 2,
+	5, 3, 2, 5, 3, 2, 5, 3, 2, 5, 3, 2, 5, 3, 2, 5,
+	3, 2, 5, 3, 2, 5, 3, 4, 0, 3, 2, 3, 4, 0, 3, 2,
+	3, 4, 0, 3, 2, 3, 3, 1, 6, 1, 3, 2, 4, 2, 5, 0,
+	3, 5, 3, 1, 5, 0, 3, 4, 3, 2, 5, 0, 3, 3, 3, 3,
+	5, 0, 3, 2, 3, 4, 5, 0, 3, 1, 3, 5, 3, 0, 6, 6,
+	3, 0, 7, 5, 5, 0, 4, 1, 3, 4, 5, 0, 3, 2, 3, 4,
+	5, 0, 3, 3, 3, 3, 5, 0, 3, 4, 3, 2, 5, 0, 3, 5,
+	3, 1, 5, 0, 3, 5, 3, 1, 3, 0, 3, 5, 3, 0, 3, 5,
+	3, 0, 3, 5, 3, 0, 3, 5, 3, 0, 3, 5, 3, 0, 3, 5,
+	3, 0, 3, 5, 3, 0, 3, 5, 3, 0, 3, 5, 3, 0, 3, 5,
+	3, 0, 3, 5, 2, 0, 8, 2, 0, 8, 4, 0, 5, 4, 5, 4,
+	0, 5, 4, 5, 4, 0, 5, 4, 5, 4, 0, 5, 4, 5, 6, 0,
+	3, 1, 2, 3, 5, 8, 0, 3, 1, 2, 2, 2, 1, 3, 8, 0,
+	3, 1, 2, 2, 2, 1, 3, 8, 0, 3, 1, 2, 2, 2, 1, 3,
+	8, 0, 3, 1, 2, 2, 2, 1, 3, 6, 0, 3, 2, 4, 2, 3,
+	6, 0, 3, 2, 4, 2, 3, 6, 0, 3, 2, 4, 2, 3, 6, 0,
+	3, 2, 4, 2, 3, 4, 0, 3, 5, 3, 4, 0, 4, 4, 3, 4,
+	0, 4, 4, 3, 4, 0, 5, 3, 3, 4, 0, 6, 2, 3, 6, 0,
+	3, 1, 2, 2, 3, 6, 0, 3, 1, 3, 1, 3, 6, 0, 3, 2,
+	2, 1, 3, 4, 0, 3, 2, 6, 4, 0, 3, 3, 5, 4, 0, 3,
+	4, 4, 4, 0, 3, 4, 4, 4, 0, 3, 5, 3, 3, 4, 5, 4,
+	3, 2, 9, 2, 5, 1, 4, 3, 4, 1, 5, 1, 3, 5, 3, 1,
+	4, 0, 3, 7, 3, 4, 0, 3, 7, 3, 4, 0, 3, 7, 3, 4,
+	0, 3, 7, 3, 4, 0, 3, 7, 3, 5, 1, 3, 5, 3, 1, 5,
+	1, 4, 3, 4, 1, 3, 2, 9, 2, 3, 4, 5, 4, 3, 0, 9,
+	2, 3, 0, 10, 1, 4, 0, 3, 4, 4, 4, 0, 3, 5, 3, 4,
+	0, 3, 5, 3, 4, 0, 3, 4, 4, 3, 0, 10, 1, 3, 0, 9,
+	2, 3, 0, 3, 8, 3, 0, 3, 8, 3, 0, 3, 8, 3, 0, 3,
+	8, 3, 0, 3, 8, 3, 4, 5, 4, 3, 2, 9, 2, 5, 1, 4,
+	3, 4, 1, 5, 1, 3, 5, 3, 1, 4, 0, 3, 7, 3, 4, 0,
+	3, 7, 3, 4, 0, 3, 7, 3, 4, 0, 3, 7, 3, 6, 0, 3,
+	4, 2, 1, 3, 5, 1, 3, 3, 5, 1, 5, 1, 4, 3, 4, 1,
+	3, 2, 10, 1, 4, 4, 5, 1, 3, 3, 11, 1, 1, 3, 0, 9,
+	3, 3, 0, 10, 2, 5, 0, 3, 5, 3, 1, 5, 0, 3, 5, 3,
+	1, 5, 0, 3, 5, 3, 1, 5, 0, 3, 5, 3, 1, 3, 0, 10,
+	2, 3, 0, 10, 2, 5, 0, 3, 5, 3, 1, 5, 0, 3, 5, 3,
+	1, 5, 0, 3, 5, 3, 1, 5, 0, 3, 5, 3, 1, 4, 0, 3,
+	5, 4, 3, 2, 6, 3, 3, 1, 9, 1, 4, 0, 4, 3, 4, 4,
+	0, 3, 5, 3, 3, 0, 3, 8, 3, 0, 7, 4, 3, 1, 9, 1,
+	2, 5, 6, 2, 8, 3, 4, 0, 3, 5, 3, 4, 1, 3, 3, 4,
+	3, 1, 9, 1, 3, 3, 6, 2, 2, 0, 9, 2, 0, 9, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 0, 3, 5, 3, 4,
+	0, 3, 5, 3, 4, 0, 3, 5, 3, 4, 0, 3, 5, 3, 4, 0,
+	3, 5, 3, 4, 0, 3, 5, 3, 4, 0, 3, 5, 3, 4, 0, 3,
+	5, 3, 4, 0, 3, 5, 3, 4, 0, 3, 5, 3, 4, 0, 4, 3,
+	4, 3, 1, 9, 1, 3, 3, 5, 3, 5, 1, 2, 6, 2, 1, 5,
+	1, 3, 4, 3, 1, 5, 1, 3, 4, 3, 1, 5, 2, 2, 4, 2,
+	2, 5, 2, 2, 4, 2, 2, 5, 2, 3, 2, 3, 2, 5, 3, 2,
+	2, 2, 3, 5, 3, 2, 2, 2, 3, 3, 3, 6, 3, 3, 4, 4,
+	4, 3, 4, 4, 4, 3, 4, 4, 4, 3, 5, 2, 5, 6, 1, 2,
+	4, 3, 4, 3, 7, 1, 3, 3, 3, 4, 2, 1, 7, 1, 3, 3,
+	3, 4, 2, 1, 7, 1, 3, 3, 4, 2, 3, 1, 9, 2, 2, 2,
+	2, 1, 2, 2, 3, 1, 9, 2, 2, 2, 2, 1, 2, 2, 2, 2,
+	9, 2, 3, 1, 2, 1, 2, 2, 2, 2, 7, 3, 2, 1, 2, 2,
+	5, 2, 7, 3, 2, 1, 2, 2, 4, 3, 5, 3, 4, 3, 4, 3,
+	5, 3, 4, 3, 4, 3, 5, 4, 3, 4, 3, 3, 5, 4, 3, 4,
+	2, 4, 5, 1, 3, 4, 3, 1, 5, 1, 4, 3, 3, 1, 5, 2,
+	3, 2, 3, 2, 3, 3, 6, 3, 3, 3, 6, 3, 3, 4, 4, 4,
+	3, 5, 3, 4, 3, 4, 4, 4, 3, 3, 6, 3, 5, 3, 2, 2,
+	3, 2, 5, 2, 3, 2, 3, 2, 5, 1, 3, 4, 3, 1, 5, 1,
+	3, 4, 3, 1, 4, 0, 3, 5, 3, 5, 0, 3, 4, 3, 1, 5,
+	1, 3, 3, 3, 1, 5, 2, 2, 3, 2, 2, 5, 2, 3, 1, 3,
+	2, 5, 3, 2, 1, 2, 3, 3, 3, 5, 3, 3, 4, 3, 4, 3,
+	4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+	4, 3, 4, 2, 0, 9, 2, 0, 9, 2, 6, 3, 3, 5, 3, 1,
+	3, 4, 4, 1, 3, 4, 3, 2, 3, 3, 3, 3, 3, 2, 3, 4,
+	3, 1, 4, 4, 3, 1, 3, 5, 3, 0, 3, 6, 2, 0, 9, 2,
+	0, 9, 2, 0, 4, 2, 0, 4, 3, 0, 3, 1, 3, 0, 3, 1,
+	3, 0, 3, 1, 3, 0, 3, 1, 3, 0, 3, 1, 3, 0, 3, 1,
+	3, 0, 3, 1, 3, 0, 3, 1, 3, 0, 3, 1, 3, 0, 3, 1,
+	3, 0, 3, 1, 3, 0, 3, 1, 3, 0, 3, 1, 2, 0, 4, 2,
+	0, 4, 3, 0, 1, 4, 3, 0, 2, 3, 3, 1, 1, 3, 3, 1,
+	1, 3, 3, 1, 2, 2, 3, 2, 1, 2, 3, 2, 1, 2, 3, 2,
+	1, 2, 3, 2, 2, 1, 3, 3, 1, 1, 3, 3, 1, 1, 2, 3,
+	2, 2, 4, 1, 2, 0, 4, 2, 0, 4, 2, 1, 3, 2, 1, 3,
+	2, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 3, 2,
+	1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1,
+	3, 2, 0, 4, 2, 0, 4, 3, 3, 2, 3, 3, 3, 3, 2, 3,
+	2, 4, 2, 3, 2, 5, 1, 5, 2, 2, 1, 2, 1, 5, 1, 2,
+	2, 2, 1, 4, 1, 2, 3, 2, 4, 0, 2, 4, 2, 2, 0, 10,
+	3, 0, 2, 1, 2, 1, 2, 3, 2, 6, 2, 3, 1, 8, 1, 5,
+	0, 3, 3, 3, 1, 3, 6, 3, 1, 3, 2, 7, 1, 5, 1, 4,
+	1, 3, 1, 5, 0, 3, 3, 3, 1, 5, 0, 3, 2, 4, 1, 3,
+	0, 9, 1, 5, 1, 4, 1, 3, 1, 3, 0, 3, 7, 3, 0, 3,
+	7, 3, 0, 3, 7, 5, 0, 3, 1, 4, 2, 3, 0, 9, 1, 5,
+	0, 4, 2, 3, 1, 4, 0, 3, 4, 3, 4, 0, 3, 4, 3, 4,
+	0, 3, 4, 3, 4, 0, 3, 4, 3, 5, 0, 4, 2, 3, 1, 3,
+	0, 9, 1, 5, 0, 3, 1, 4, 2, 3, 3, 5, 1, 2, 1, 8,
+	4, 1, 3, 3, 2, 3, 0, 3, 6, 3, 0, 3, 6, 3, 0, 3,
+	6, 3, 0, 3, 6, 4, 1, 3, 3, 2, 2, 1, 8, 3, 3, 4,
+	2, 2, 6, 3, 2, 6, 3, 2, 6, 3, 4, 2, 3, 1, 3, 2,
+	1, 8, 4, 1, 3, 1, 4, 4, 0, 3, 3, 3, 4, 0, 3, 3,
+	3, 4, 0, 3, 3, 3, 4, 0, 3, 3, 3, 4, 0, 4, 1, 4,
+	2, 1, 8, 4, 2, 3, 1, 3, 3, 2, 5, 2, 3, 1, 7, 1,
+	5, 1, 3, 2, 2, 1, 4, 0, 3, 4, 2, 2, 0, 9, 2, 0,
+	9, 3, 0, 3, 6, 4, 0, 3, 4, 2, 2, 1, 8, 3, 3, 4,
+	2, 2, 2, 3, 2, 1, 4, 3, 1, 3, 1, 2, 0, 5, 2, 0,
+	5, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+	1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+	1, 4, 2, 3, 1, 3, 2, 1, 8, 4, 1, 3, 1, 4, 4, 0,
+	3, 3, 3, 4, 0, 3, 3, 3, 4, 0, 3, 3, 3, 4, 0, 3,
+	3, 3, 4, 0, 4, 1, 4, 2, 1, 8, 4, 2, 3, 1, 3, 2,
+	6, 3, 4, 0, 3, 3, 3, 3, 1, 7, 1, 3, 2, 5, 2, 3,
+	0, 3, 6, 3, 0, 3, 6, 3, 0, 3, 6, 5, 0, 3, 1, 4,
+	1, 2, 0, 9, 4, 0, 4, 2, 3, 4, 0, 3, 3, 3, 4, 0,
+	3, 3, 3, 4, 0, 3, 3, 3, 4, 0, 3, 3, 3, 4, 0, 3,
+	3, 3, 4, 0, 3, 3, 3, 4, 0, 3, 3, 3, 2, 0, 3, 2,
+	0, 3, 1, 3, 2, 0, 3, 2, 0, 3, 2, 0, 3, 2, 0, 3,
+	2, 0, 3, 2, 0, 3, 2, 0, 3, 2, 0, 3, 2, 0, 3, 2,
+	0, 3, 2, 1, 3, 2, 1, 3, 1, 4, 2, 1, 3, 2, 1, 3,
+	2, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 3, 2,
+	1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 3, 2, 0,
+	4, 3, 0, 3, 1, 3, 0, 3, 6, 3, 0, 3, 6, 3, 0, 3,
+	6, 4, 0, 3, 3, 3, 5, 0, 3, 2, 3, 1, 5, 0, 3, 1,
+	3, 2, 3, 0, 6, 3, 3, 0, 6, 3, 3, 0, 7, 2, 5, 0,
+	3, 1, 3, 2, 5, 0, 3, 2, 3, 1, 5, 0, 3, 3, 2, 1,
+	4, 0, 3, 3, 3, 2, 0, 3, 2, 0, 3, 2, 0, 3, 2, 0,
+	3, 2, 0, 3, 2, 0, 3, 2, 0, 3, 2, 0, 3, 2, 0, 3,
+	2, 0, 3, 2, 0, 3, 2, 0, 3, 2, 0, 3, 7, 0, 3, 1,
+	4, 1, 4, 1, 2, 0, 14, 6, 0, 3, 3, 3, 2, 3, 6, 0,
+	3, 3, 3, 2, 3, 6, 0, 3, 3, 3, 2, 3, 6, 0, 3, 3,
+	3, 2, 3, 6, 0, 3, 3, 3, 2, 3, 6, 0, 3, 3, 3, 2,
+	3, 6, 0, 3, 3, 3, 2, 3, 6, 0, 3, 3, 3, 2, 3, 5,
+	0, 3, 1, 4, 1, 2, 0, 9, 4, 0, 3, 3, 3, 4, 0, 3,
+	3, 3, 4, 0, 3, 3, 3, 4, 0, 3, 3, 3, 4, 0, 3, 3,
+	3, 4, 0, 3, 3, 3, 4, 0, 3, 3, 3, 4, 0, 3, 3, 3,
+	3, 3, 4, 3, 3, 1, 8, 1, 5, 1, 3, 2, 3, 1, 4, 0,
+	3, 4, 3, 4, 0, 3, 4, 3, 4, 0, 3, 4, 3, 4, 0, 3,
+	4, 3, 5, 1, 3, 2, 3, 1, 3, 1, 8, 1, 3, 3, 4, 3,
+	5, 0, 3, 1, 4, 2, 3, 0, 9, 1, 5, 0, 4, 2, 3, 1,
+	4, 0, 3, 4, 3, 4, 0, 3, 4, 3, 4, 0, 3, 4, 3, 4,
+	0, 3, 4, 3, 5, 0, 4, 2, 3, 1, 3, 0, 9, 1, 5, 0,
+	3, 1, 4, 2, 3, 0, 3, 7, 3, 0, 3, 7, 3, 0, 3, 7,
+	3, 0, 3, 7, 4, 2, 3, 1, 3, 2, 1, 8, 4, 0, 4, 1,
+	4, 4, 0, 3, 3, 3, 4, 0, 3, 3, 3, 4, 0, 3, 3, 3,
+	4, 0, 3, 3, 3, 4, 0, 4, 1, 4, 2, 1, 8, 4, 2, 3,
+	1, 3, 2, 6, 3, 2, 6, 3, 2, 6, 3, 2, 6, 3, 4, 0,
+	3, 1, 2, 2, 0, 6, 3, 0, 4, 2, 3, 0, 3, 3, 3, 0,
+	3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 3, 0,
+	3, 3, 3, 0, 3, 3, 3, 2, 5, 2, 3, 1, 7, 1, 4, 0,
+	3, 3, 3, 3, 0, 3, 6, 3, 0, 6, 3, 2, 1, 8, 2, 4,
+	5, 4, 0, 3, 3, 3, 3, 0, 8, 1, 3, 2, 5, 2, 3, 1,
+	3, 1, 3, 1, 3, 1, 2, 0, 5, 2, 0, 5, 3, 1, 3, 1,
+	3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+	3, 1, 3, 1, 2, 1, 4, 2, 2, 3, 4, 0, 3, 3, 3, 4,
+	0, 3, 3, 3, 4, 0, 3, 3, 3, 4, 0, 3, 3, 3, 4, 0,
+	3, 3, 3, 4, 0, 3, 3, 3, 4, 0, 3, 3, 3, 4, 0, 3,
+	3, 3, 2, 0, 9, 4, 1, 4, 1, 3, 5, 0, 3, 4, 2, 1,
+	5, 1, 2, 4, 2, 1, 5, 1, 3, 2, 3, 1, 5, 1, 3, 2,
+	2, 2, 5, 2, 2, 2, 2, 2, 5, 2, 2, 1, 3, 2, 3, 2,
+	5, 3, 3, 3, 4, 3, 3, 3, 4, 3, 3, 3, 3, 4, 6, 0,
+	3, 3, 2, 3, 3, 7, 1, 2, 2, 4, 2, 2, 1, 7, 1, 2,
+	2, 4, 2, 2, 1, 7, 1, 2, 2, 4, 2, 2, 1, 7, 1, 3,
+	1, 4, 1, 3, 1, 9, 2, 2, 1, 1, 2, 1, 1, 2, 2, 5,
+	2, 4, 2, 4, 2, 5, 2, 4, 2, 4, 2, 5, 2, 4, 2, 4,
+	2, 5, 3, 3, 2, 3, 3, 5, 1, 3, 2, 3, 1, 5, 1, 3,
+	2, 3, 1, 3, 2, 6, 2, 3, 3, 4, 3, 3, 3, 4, 3, 3,
+	3, 4, 3, 3, 3, 4, 3, 3, 2, 6, 2, 5, 1, 3, 2, 3,
+	1, 5, 1, 3, 2, 3, 1, 4, 0, 3, 4, 3, 5, 1, 2, 4,
+	2, 1, 5, 1, 3, 2, 3, 1, 5, 1, 3, 2, 3, 1, 5, 2,
+	2, 2, 2, 2, 5, 2, 3, 1, 2, 2, 3, 2, 5, 3, 3, 3,
+	4, 3, 3, 3, 4, 3, 3, 4, 2, 4, 3, 4, 2, 4, 3, 3,
+	3, 4, 3, 2, 3, 5, 3, 2, 3, 5, 3, 0, 7, 1, 3, 0,
+	7, 1, 3, 4, 3, 1, 3, 3, 3, 2, 3, 2, 3, 3, 3, 2,
+	3, 3, 3, 1, 3, 4, 3, 0, 3, 5, 2, 0, 8, 2, 0, 8,
+	2, 2, 2, 2, 1, 3, 3, 1, 2, 1, 3, 1, 2, 1, 3, 1,
+	2, 1, 3, 1, 2, 1, 3, 1, 2, 1, 3, 0, 3, 1, 3, 0,
+	3, 1, 3, 1, 2, 1, 3, 1, 2, 1, 3, 1, 2, 1, 3, 1,
+	2, 1, 3, 1, 2, 1, 3, 1, 2, 1, 2, 1, 3, 2, 2, 2,
+	2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2,
+	0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0,
+	1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1,
+	2, 0, 1, 3, 0, 2, 2, 3, 0, 3, 1, 3, 1, 2, 1, 3,
+	1, 2, 1, 3, 1, 2, 1, 3, 1, 2, 1, 3, 1, 2, 1, 2,
+	1, 3, 2, 1, 3, 3, 1, 2, 1, 3, 1, 2, 1, 3, 1, 2,
+	1, 3, 1, 2, 1, 3, 1, 2, 1, 3, 1, 2, 1, 3, 0, 3,
+	1, 3, 0, 2, 2, 4, 1, 3, 3, 1, 5, 0, 1, 3, 3, 1,
+};
+
+const uint16_t FreeSansBold9pt7bSpanOffsets[] = {		// 0x20 .. 0x7E
+	0, 0, 41, 67, 129, 194, 283, 352, 368, 436, 498, 525, 555, 571, 577, 583,
+	633, 696, 735, 785, 837, 897, 950, 1010, 1059, 1118, 1177, 1199, 1231, 1263, 1279, 1311,
+	1361, 1462, 1526, 1586, 1643, 1708, 1756, 1806, 1867, 1928, 1967, 2014, 2088, 2138, 2229, 2300,
+	2365, 2421, 2493, 2562, 2616, 2666, 2729, 2797, 2898, 2964, 3027, 3074, 3138, 3188, 3239, 3277,
+	3280, 3287, 3337, 3401, 3441, 3496, 3537, 3585, 3647, 3708, 3746, 3797, 3861, 3900, 3967, 4016,
+	4064, 4132, 4190, 4230, 4270, 4314, 4362, 4414, 4487, 4535, 4602, 4640, 4704, 4755, 4821,
+};
+
+const uint8_t FreeSansBold9pt7bAdvances[] = {		// 0x20 .. 0x7E
+	5, 6, 9, 10, 10, 16, 13, 5, 6, 6, 7, 11, 4, 6, 4, 5,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 11, 11, 11, 11,
+	18, 13, 13, 13, 13, 12, 11, 14, 13, 6, 10, 13, 11, 16, 14, 14,
+	12, 14, 13, 12, 12, 13, 12, 17, 12, 12, 11, 6, 5, 6, 11, 10,
+	5, 10, 11, 10, 11, 10, 6, 11, 11, 5, 5, 10, 5, 16, 11, 11,
+	11, 11, 7, 10, 6, 11, 10, 14, 10, 10, 9, 7, 5, 7, 9,
+};
+
+const GFXmetrics FreeSansBold9pt7bMetrics = {
+	-13, 5, 19, 18, FreeSansBold9pt7bAdvances
+};
+
+// Approx. 5125 bytes
+
+#endif /* __FREESANSBOLD9PT7B_RENDER_H_ */
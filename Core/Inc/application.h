@@ -41,6 +41,8 @@
 #define FOOTER_FONT				FONT_16X24
 #define FOOTER_COLOR			RGB(66,66,66)
 #define FOOTER_TEXT_COLOR		RGB(0,0,0)
+#define FOOTER_QUEUE			4		// pending footer messages
+#define FOOTER_MSG_TIME			2000	// [ms] DrawFooter() message time
 
 // 1st measurement (main maesurement)
 #define VALUE1_FONT				FONT_32X50
@@ -53,6 +55,16 @@
 #define UNIT1_YPOS				(VALUE1_YPOS-2)
 #define UNIT1_COLOR				RGB(99,66,0)
 
+// BAR graph below the main measurement, fed from the single conversions
+#define BAR_XPOS				VALUE1_XPOS
+#define BAR_YPOS				(VALUE1_YPOS+14)
+#define BAR_HEIGHT				8
+#define BAR_SEGMENTS			50
+#define BAR_SEGMENT_WIDTH		6		// plus 1 pixel gap
+#define BAR_ON_COLOR			RGB(99,66,0)
+#define BAR_OFF_COLOR			RGB(20,20,20)
+#define BAR_INTERVAL			50		// min. ms between updates
+
 // 2nd measurement (FREQ -> Duty, ACV/I -> Freq)
 #define VALUE2_FONT				FONT_16X24
 #define VALUE2_XPOS				VALUE1_XPOS
@@ -75,6 +87,14 @@
 #define UNIT3_YPOS				VALUE3_YPOS
 #define UNIT3_COLOR				RGB(99,66,0)
 
+// TREND chart (hardware scrolled, see trend.c)
+#define TREND_XPOS				64		// fixed area left of the plot: axis labels
+#define TREND_WIDTH				( BUTTON_XPOS - SPACING - TREND_XPOS )
+#define TREND_TOP				( HEADER_HEIGHT + SPACING )
+#define TREND_BOTTOM			( TFT_HEIGHT - SPACING - 1 )
+#define TREND_COLOR				RGB(99,66,0)
+#define TREND_GRID_COLOR		RGB(20,20,20)
+
 // TIME
 #define TIME_FONT				FONT_10X16
 #define TIME_COLOR				RGB(0,0,0)
@@ -84,7 +104,19 @@
 
 #define AUTO_YPOS				( HEADER_HEIGHT + 20 )
 
-#define START_REPEAT			50
+#define FRAME_RATE_MIN			2		// display refresh rate [Hz]
+#define FRAME_RATE_MAX			20
+#define FRAME_RATE_DEFAULT		10
+
+typedef struct {
+	uint32_t frames;		// frames with at least one widget repainted
+	uint32_t widgets;		// widgets repainted in total
+	uint32_t last;			// render time of last frame [us]
+	uint32_t max;			// longest render time [us]
+	uint32_t budget;		// frame period [us]
+	uint32_t overBudget;	// frames rendering longer than budget
+	uint32_t dropped;		// frames skipped, because the previous one was still in flight
+} FRAME_STATS;
 
 typedef void (*CALLBACK)(uint8_t,int);
 
@@ -107,7 +139,22 @@ void SetHold( int mode );
 void SetAuto( int mode );
 void SetScale( uint8_t channel, int scale );
 
+enum { MSG_INFO, MSG_WARNING, MSG_ERROR };		// footer message priority, MSG_ERROR on WARNING_COLOR
+
 void DrawFooter( char *msg, ... );
+void FooterMessage( uint8_t prio, uint16_t ms, const char *msg, ... );
+void ClearFooter( void );
+void RedrawScreen( void );
+void ClockChanged( void );
+void SetRemote( uint8_t on );
+uint8_t GetRemote( void );
+const FRAME_STATS *GetFrameStats( void );
+void ResetFrameStats( void );
+void SetFrameRate( int hz );
+uint8_t GetFrameRate( void );
+void SetDisplayFilter( uint8_t on );
+uint8_t GetDisplayFilter( void );
+uint32_t GetReadings( void );
 
 void Application( void );
 
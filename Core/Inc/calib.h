@@ -48,11 +48,23 @@ extern CALIBDATA calib[DMM_CNTSCALES];
 #define MODEL			((const char*)0x0801F850)
 #define MANUFACTURER	((const char*)0x0801F864)
 
-// Calibration procedure functions
+enum {							// calibration points
+	CALIB_ZERO,
+	CALIB_POSITIVE,
+	CALIB_NEGATIVE,				// DC and TEMP only
+	CALIB_IDLE
+};
+
+// Calibration procedure functions, blocking
 uint8_t	CALIB_CalibOnZero(double *pMeasuredVal);
 uint8_t	CALIB_CalibOnPositive(double dRefVal, double *pMeasuredVal);
 uint8_t	CALIB_CalibOnNegative(double dRefVal, double *pMeasuredVal);
 
+// non-blocking: CALIB_Poll() replaces DMM_Measure() while CALIB_Busy()
+uint8_t	CALIB_Start(uint8_t point, double dRefVal);
+uint8_t	CALIB_Poll(double *pMeasuredVal);
+uint8_t	CALIB_Busy(void);
+
 // initialization
 uint8_t	CALIB_Init();
 
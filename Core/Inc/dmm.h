@@ -21,6 +21,7 @@
 #define __DMMCFG_H
 
 #include "stdint.h"
+#include "numfmt.h"
 
 #define ERRVAL_SUCCESS                  0       // success
 
@@ -153,7 +154,6 @@ enum {
 typedef struct _DMMCFG{
     int mode;			// scale
     double range;		// full scale range
-    char *fmt;			// display format, i.e. "%-2.3f"
     uint8_t sw;			// switch bits
     uint8_t cfg[21];	// configuration bits: 0x1F...0x33
     double mul;			// dmm measurement (ad1/rms) multiplication factor to get value in corresponding unit
@@ -238,22 +238,45 @@ typedef struct {
     uint8_t																																							R37;		// 0x37
 } __attribute__((__packed__)) DMMREGISTERS;
 
+#define DISP_DC		0x0001		// DMMDISP flags
+#define DISP_AC		0x0002
+#define DISP_VOLT	0x0004
+#define DISP_CURR	0x0008
+#define DISP_RES	0x0010		// 2W, 4W and continuity
+#define DISP_FRES	0x0020
+#define DISP_CAP	0x0040
+#define DISP_FREQ	0x0080
+#define DISP_TEMP	0x0100
+#define DISP_CONT	0x0200
+#define DISP_DIOD	0x0400
+
+typedef struct {
+	const char *name;	// range name, i.e. "50mV DC"
+	const char *unit;	// prefixed unit, i.e. "mV="
+	double factor;		// base unit -> prefixed unit, i.e. 1e3
+	double fullscale;	// full scale range in the prefixed unit
+	NUMFMT fmt;			// display format
+	uint16_t flags;		// DISP_xxx
+} DMMDISP;
+
 extern const DMMCFG dmmcfg[];
-extern const char * const dmmranges[];
+extern const DMMDISP dmmdisp[];
 
 extern uint32_t currCTA, currCTB, currCTC;
 extern double currAD1, currAD2, currAD3, currRMS;
 
 extern double dMeasuredVal[NUM_CHANNELS];
 
+extern double dFastVal;
+extern uint32_t nFastCount;
+
 uint8_t	DMM_SetScale( uint8_t ch, int idxScale );
 int		DMM_GetScale( uint8_t ch );
 int		DMM_FindScale( int mode, double range );
 
 int		DMM_GetMode( int idxScale );
 double	DMM_GetRange( int idxScale );
-uint8_t	DMM_GetScaleUnit( uint8_t scale, double *pdScaleFact, char *szUnitPrefix, char *szUnit, char *szRange );
-const char *DMM_GetFormat( int idxScale );
+const DMMDISP *DMM_GetDisplay( int idxScale );
 
 // value functions
 uint8_t	DMM_Ready( uint8_t channel );
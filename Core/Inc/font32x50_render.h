@@ -0,0 +1,199 @@
+// Generated by Tools/fontspans.py from font32x50.h - do not edit
+
+#ifndef __FONT32X50_RENDER_H_
+#define __FONT32X50_RENDER_H_
+
+#include "gfxfont.h"
+
+const uint8_t font32x50Spans[] = {
+	3, 0, 4, 28, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32,
+	1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32,
+	2, 31, 1, 2, 30, 2, 4, 0, 1, 28, 3, 4, 0, 2, 27, 3,
+	4, 0, 2, 27, 3, 4, 0, 2, 27, 3, 4, 0, 2, 27, 3, 4,
+	0, 2, 27, 3, 4, 0, 2, 27, 3, 4, 0, 2, 21, 9, 4, 0,
+	8, 13, 11, 4, 0, 10, 10, 12, 4, 0, 11, 10, 11, 4, 0, 10,
+	13, 9, 4, 0, 8, 21, 3, 4, 0, 2, 27, 3, 4, 0, 2, 27,
+	3, 4, 0, 2, 27, 3, 4, 0, 2, 27, 3, 4, 0, 2, 27, 3,
+	4, 0, 2, 27, 3, 4, 0, 2, 28, 2, 4, 0, 1, 30, 1, 1,
+	32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1,
+	32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1,
+	32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1,
+	32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1,
+	32, 1, 32, 1, 32, 1, 32, 2, 23, 9, 4, 0, 8, 13, 11, 4,
+	0, 10, 10, 12, 4, 0, 11, 10, 11, 4, 0, 10, 13, 9, 3, 0,
+	8, 24, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32,
+	1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32,
+	1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 5, 12,
+	1, 2, 1, 16, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32,
+	1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32,
+	1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32,
+	1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32,
+	1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32,
+	1, 32, 1, 32, 1, 32, 1, 32, 2, 28, 4, 4, 0, 4, 24, 4,
+	4, 0, 4, 24, 4, 4, 0, 4, 24, 4, 4, 0, 4, 24, 4, 1,
+	32, 1, 32, 3, 8, 15, 9, 3, 7, 17, 8, 3, 6, 19, 7, 5,
+	7, 17, 1, 2, 5, 7, 4, 2, 2, 15, 1, 4, 4, 5, 3, 4,
+	16, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5,
+	2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6,
+	3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6,
+	15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5,
+	2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6,
+	3, 5, 2, 5, 18, 4, 3, 5, 2, 3, 22, 2, 3, 5, 2, 1,
+	25, 1, 3, 1, 32, 3, 2, 1, 29, 5, 2, 3, 22, 2, 3, 5,
+	2, 5, 18, 4, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6,
+	3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6,
+	15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5,
+	2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6,
+	3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6,
+	15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 3, 4, 17, 4, 4, 7,
+	4, 2, 2, 15, 2, 2, 5, 3, 7, 17, 8, 3, 6, 19, 7, 3,
+	7, 17, 8, 3, 8, 15, 9, 1, 32, 1, 32, 1, 32, 1, 32, 1,
+	32, 1, 32, 1, 32, 1, 32, 3, 1, 2, 29, 4, 0, 4, 27, 1,
+	4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4,
+	0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0,
+	5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5,
+	26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26,
+	1, 3, 0, 5, 27, 3, 1, 4, 27, 3, 3, 2, 27, 3, 4, 1,
+	27, 1, 32, 1, 32, 3, 3, 2, 27, 4, 1, 4, 26, 1, 4, 0,
+	5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5,
+	26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26,
+	1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1,
+	4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 3,
+	0, 5, 27, 3, 0, 4, 28, 3, 1, 2, 29, 1, 32, 1, 32, 1,
+	32, 1, 32, 1, 32, 3, 15, 1, 16, 1, 32, 2, 24, 8, 4, 0,
+	7, 16, 9, 4, 0, 8, 14, 10, 4, 0, 9, 14, 9, 6, 0, 8,
+	1, 2, 13, 8, 5, 0, 7, 1, 4, 20, 3, 7, 6, 19, 3, 7,
+	6, 19, 3, 7, 6, 19, 3, 7, 6, 19, 3, 7, 6, 19, 3, 7,
+	6, 19, 3, 7, 6, 19, 3, 7, 6, 19, 3, 7, 6, 19, 3, 7,
+	6, 19, 3, 7, 6, 19, 3, 7, 6, 19, 3, 7, 6, 19, 3, 7,
+	6, 19, 4, 9, 4, 10, 9, 6, 0, 7, 4, 2, 9, 10, 6, 0,
+	9, 3, 1, 7, 12, 6, 0, 11, 7, 1, 2, 11, 6, 0, 10, 8,
+	3, 2, 9, 5, 0, 8, 10, 5, 9, 3, 18, 6, 8, 3, 18, 6,
+	8, 3, 18, 6, 8, 3, 18, 6, 8, 3, 18, 6, 8, 3, 18, 6,
+	8, 3, 18, 6, 8, 3, 18, 6, 8, 3, 18, 6, 8, 3, 18, 6,
+	8, 3, 18, 6, 8, 3, 18, 6, 8, 3, 18, 6, 8, 3, 18, 6,
+	8, 3, 19, 4, 9, 4, 20, 2, 2, 8, 4, 0, 7, 16, 9, 4,
+	0, 8, 14, 10, 4, 0, 9, 14, 9, 4, 0, 8, 16, 8, 3, 0,
+	7, 25, 1, 32, 3, 22, 1, 9, 1, 32, 1, 32, 4, 0, 15, 16,
+	1, 4, 0, 16, 14, 2, 4, 0, 17, 14, 1, 5, 0, 16, 1, 2,
+	13, 5, 0, 15, 1, 4, 12, 3, 15, 6, 11, 3, 15, 6, 11, 3,
+	15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3,
+	15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3,
+	15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 4,
+	17, 4, 10, 1, 6, 0, 15, 4, 2, 9, 2, 6, 0, 17, 3, 1,
+	7, 4, 4, 0, 19, 10, 3, 4, 0, 18, 13, 1, 5, 0, 16, 3,
+	2, 11, 3, 17, 4, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3, 15,
+	6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3, 15,
+	6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3, 15,
+	6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3, 16,
+	4, 12, 6, 0, 15, 2, 2, 12, 1, 4, 0, 16, 14, 2, 4, 0,
+	17, 14, 1, 3, 0, 16, 16, 3, 0, 15, 17, 1, 32, 2, 30, 2,
+	1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 3, 25, 2, 5, 5, 4,
+	2, 18, 4, 4, 5, 3, 4, 16, 6, 3, 5, 2, 6, 15, 6, 3,
+	5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15,
+	6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2,
+	6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3,
+	5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15,
+	6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 5, 18, 4, 3, 7, 2,
+	3, 2, 16, 4, 2, 3, 7, 2, 1, 3, 19, 3, 1, 3, 3, 4,
+	23, 5, 3, 5, 21, 6, 5, 7, 17, 3, 2, 3, 3, 25, 4, 3,
+	3, 23, 6, 3, 3, 23, 6, 3, 3, 23, 6, 3, 3, 23, 6, 3,
+	3, 23, 6, 3, 3, 23, 6, 3, 3, 23, 6, 3, 3, 23, 6, 3,
+	3, 23, 6, 3, 3, 23, 6, 3, 3, 23, 6, 3, 3, 23, 6, 3,
+	3, 23, 6, 3, 3, 23, 6, 3, 3, 24, 4, 4, 3, 25, 2, 5,
+	1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 1, 32, 3, 5, 1, 26,
+	1, 32, 3, 16, 15, 1, 2, 15, 17, 2, 14, 18, 4, 0, 1, 14,
+	17, 5, 12, 2, 2, 15, 1, 3, 11, 4, 17, 3, 10, 6, 16, 3,
+	10, 6, 16, 3, 10, 6, 16, 3, 10, 6, 16, 3, 10, 6, 16, 3,
+	10, 6, 16, 3, 10, 6, 16, 3, 10, 6, 16, 3, 10, 6, 16, 3,
+	10, 6, 16, 3, 10, 6, 16, 3, 10, 6, 16, 3, 10, 6, 16, 3,
+	10, 5, 17, 5, 10, 3, 2, 16, 1, 4, 10, 1, 3, 18, 4, 0,
+	1, 11, 20, 4, 0, 3, 10, 19, 4, 0, 2, 13, 17, 3, 3, 2,
+	27, 4, 1, 4, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1,
+	4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4,
+	0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0,
+	5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5,
+	26, 1, 4, 0, 5, 26, 1, 3, 0, 5, 27, 5, 0, 4, 12, 15,
+	1, 4, 1, 2, 12, 17, 2, 14, 18, 4, 0, 1, 14, 17, 3, 16,
+	15, 1, 1, 32, 1, 32, 5, 13, 1, 1, 1, 16, 1, 32, 2, 24,
+	8, 4, 0, 7, 16, 9, 4, 0, 8, 14, 10, 4, 0, 9, 14, 9,
+	6, 0, 8, 12, 2, 2, 8, 5, 0, 7, 12, 4, 9, 3, 18, 6,
+	8, 3, 18, 6, 8, 3, 18, 6, 8, 3, 18, 6, 8, 3, 18, 6,
+	8, 3, 18, 6, 8, 3, 18, 6, 8, 3, 18, 6, 8, 3, 18, 6,
+	8, 3, 18, 6, 8, 3, 18, 6, 8, 3, 18, 6, 8, 3, 18, 6,
+	8, 3, 18, 5, 9, 4, 18, 3, 2, 9, 6, 0, 7, 11, 1, 3,
+	10, 4, 0, 9, 11, 12, 6, 0, 11, 7, 1, 2, 11, 6, 0, 10,
+	8, 3, 2, 9, 7, 0, 8, 3, 2, 5, 5, 9, 5, 9, 4, 5,
+	6, 8, 5, 7, 6, 5, 6, 8, 5, 7, 6, 5, 6, 8, 5, 7,
+	6, 5, 6, 8, 5, 7, 6, 5, 6, 8, 5, 7, 6, 5, 6, 8,
+	5, 7, 6, 5, 6, 8, 5, 7, 6, 5, 6, 8, 5, 7, 6, 5,
+	6, 8, 5, 7, 6, 5, 6, 8, 5, 7, 6, 5, 6, 8, 5, 7,
+	6, 5, 6, 8, 5, 7, 6, 5, 6, 8, 5, 7, 6, 5, 6, 8,
+	5, 7, 6, 6, 4, 9, 6, 8, 4, 8, 2, 2, 8, 6, 0, 7,
+	2, 2, 12, 9, 4, 0, 8, 14, 10, 4, 0, 9, 14, 9, 4, 0,
+	8, 16, 8, 3, 0, 7, 25, 1, 32, 3, 21, 2, 9, 1, 32, 1,
+	32, 4, 0, 15, 16, 1, 4, 0, 16, 14, 2, 4, 0, 17, 14, 1,
+	5, 0, 16, 1, 2, 13, 5, 0, 15, 1, 4, 12, 3, 15, 6, 11,
+	3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11,
+	3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11,
+	3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11,
+	3, 15, 6, 11, 3, 17, 4, 11, 3, 19, 2, 11, 3, 20, 1, 11,
+	1, 32, 1, 32, 3, 19, 2, 11, 3, 17, 4, 11, 3, 15, 6, 11,
+	3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11,
+	3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11,
+	3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11, 3, 15, 6, 11,
+	3, 15, 6, 11, 3, 16, 4, 12, 3, 17, 2, 13, 1, 32, 1, 32,
+	1, 32, 1, 32, 1, 32, 2, 29, 3, 1, 32, 1, 32, 3, 8, 15,
+	9, 3, 7, 17, 8, 3, 6, 19, 7, 5, 7, 17, 1, 2, 5, 7,
+	4, 2, 2, 15, 1, 4, 4, 5, 3, 4, 16, 6, 3, 5, 2, 6,
+	15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5,
+	2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6,
+	3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6,
+	15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5,
+	2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 5, 18, 4,
+	3, 7, 2, 3, 2, 16, 4, 2, 3, 7, 2, 1, 3, 19, 3, 1,
+	3, 3, 4, 23, 5, 5, 2, 1, 2, 21, 6, 7, 2, 3, 2, 17,
+	3, 2, 3, 5, 2, 5, 18, 4, 3, 5, 2, 6, 15, 6, 3, 5,
+	2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6,
+	3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6,
+	15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5,
+	2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6,
+	3, 5, 2, 6, 15, 6, 3, 5, 2, 6, 15, 6, 3, 5, 3, 4,
+	17, 4, 4, 7, 4, 2, 2, 15, 2, 2, 5, 3, 7, 17, 8, 3,
+	6, 19, 7, 3, 7, 17, 8, 3, 8, 15, 9, 1, 32, 1, 32, 3,
+	4, 1, 27, 1, 32, 3, 16, 15, 1, 2, 15, 17, 2, 14, 18, 4,
+	0, 1, 14, 17, 7, 1, 2, 9, 2, 2, 15, 1, 6, 0, 4, 7,
+	4, 16, 1, 6, 0, 5, 5, 6, 15, 1, 6, 0, 5, 5, 6, 15,
+	1, 6, 0, 5, 5, 6, 15, 1, 6, 0, 5, 5, 6, 15, 1, 6,
+	0, 5, 5, 6, 15, 1, 6, 0, 5, 5, 6, 15, 1, 6, 0, 5,
+	5, 6, 15, 1, 6, 0, 5, 5, 6, 15, 1, 6, 0, 5, 5, 6,
+	15, 1, 6, 0, 5, 5, 6, 15, 1, 6, 0, 5, 5, 6, 15, 1,
+	6, 0, 5, 5, 6, 15, 1, 6, 0, 5, 5, 6, 15, 1, 5, 0,
+	5, 5, 5, 17, 7, 1, 4, 5, 3, 2, 16, 1, 6, 3, 2, 5,
+	1, 3, 18, 6, 0, 1, 3, 1, 7, 20, 4, 0, 3, 10, 19, 4,
+	0, 2, 13, 17, 3, 3, 2, 27, 4, 1, 4, 26, 1, 4, 0, 5,
+	26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26,
+	1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1,
+	4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 4,
+	0, 5, 26, 1, 4, 0, 5, 26, 1, 4, 0, 5, 26, 1, 3, 0,
+	5, 27, 5, 0, 4, 12, 15, 1, 4, 1, 2, 12, 17, 2, 14, 18,
+	4, 0, 1, 14, 17, 3, 16, 15, 1,
+};
+
+const uint16_t font32x50SpanOffsets[] = {		// 0x20 .. 0x39
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 167, 167, 282, 399,
+	399, 667, 869, 1092, 1309, 1530, 1748, 2007, 2196, 2475,
+};
+
+const uint8_t font32x50Advances[] = {		// 0x20 .. 0x39
+	34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 10, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+};
+
+const GFXmetrics font32x50Metrics = {
+	-49, 1, 51, 34, font32x50Advances
+};
+
+// Approx. 2831 bytes
+
+#endif /* __FONT32X50_RENDER_H_ */
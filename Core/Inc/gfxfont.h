@@ -58,6 +58,15 @@ typedef struct {
 	uint8_t yAdvance;		// Newline distance (y axis)
 } GFXfont;
 
+/// Metrics of a FONT AS A WHOLE, generated by Tools/fontspans.py
+typedef struct {
+	int8_t ascent;			// tallest glyph above base line (negative Y!)
+	int8_t descent;			// deepest under-cut below base line (positive Y!)
+	uint8_t height;			// descent - ascent + 1
+	uint8_t maxAdvance;		// widest xAdvance of all glyphs
+	const uint8_t *advance;	// xAdvance per glyph, first .. last
+} GFXmetrics;
+
 #define PROGMEM
 
 #endif /* CORE_INC_GFXFONT_H_ */
@@ -8,6 +8,8 @@
 #ifndef CORE_INC_KBD_H_
 #define CORE_INC_KBD_H_
 
+#include <stdint.h>
+
 enum {
 	KEY_NONE = 0,
 	KEY_F4,		KEY_F3,		KEY_F2,		KEY_F1,		KEY_VOLT,
@@ -17,7 +19,22 @@ enum {
 	KEY_TEMP,	KEY_SPARE,	KEY_RIGHT,	KEY_PORT,	KEY_FREQ
 } KEYS;
 
+// events from KBD_GetEvent(): type | key
+#define KEY_PRESS			0x00
+#define KEY_RELEASE			0x40
+#define KEY_REPEAT			0x80
+#define KEY_CODE( ev )		( (ev) & 0x3F )
+#define KEY_TYPE( ev )		( (ev) & 0xC0 )
+
+#define KBD_SCAN_MS			5		// one drive line per SysTick
+#define KBD_DEBOUNCE		4		// scans a key must be stable to change state (20 ms)
+#define KBD_REPEAT_DELAY	500		// [ms] held until the first repeat event
+#define KBD_REPEAT_RATE		100		// [ms] between repeat events
+
 void  KBD_Init( void );
+void KBD_Tick( void );
+uint8_t KBD_GetEvent( void );
+void KBD_Flush( void );
 uint8_t KBD_Read( void );
 
 #endif /* CORE_INC_KBD_H_ */
@@ -0,0 +1,29 @@
+/*
+ * numfmt.h
+ *
+ *  Created on: 19.10.2026
+ *      Author: aziemer
+ */
+
+#ifndef CORE_INC_NUMFMT_H_
+#define CORE_INC_NUMFMT_H_
+
+#include <stdint.h>
+
+#define NUM_SIGN		0x01		// always print the sign, like printf's '+' flag
+
+typedef struct {
+	uint8_t width;					// minimum field width, padded with spaces on the left
+	uint8_t decimals;				// digits after the decimal point
+	uint8_t flags;					// NUM_xxx
+} NUMFMT;
+
+int32_t NUM_Round( double val, uint8_t decimals );
+uint8_t NUM_Fixed( char *str, int32_t val, uint8_t decimals, uint8_t width, uint8_t flags );
+uint8_t NUM_Format( char *str, double val, const NUMFMT *fmt );
+uint8_t NUM_Exp( char *str, double val, uint8_t digits, uint8_t flags );
+uint8_t NUM_Uint( char *str, uint32_t val, uint8_t width, char pad );
+
+void NUM_Benchmark( uint32_t result[2] );		// TFT_BENCHMARK only
+
+#endif /* CORE_INC_NUMFMT_H_ */
@@ -0,0 +1,45 @@
+/*
+ * sched.h
+ *
+ *  Created on: 19.10.2026
+ *      Author: aziemer
+ */
+
+#ifndef CORE_INC_SCHED_H_
+#define CORE_INC_SCHED_H_
+
+#include <stdint.h>
+
+enum {				// task ids, in order of priority
+	TASK_ACQ,		// HY3131 pickup
+	TASK_SCPI,		// command from RS232 or USB
+	TASK_KEYS,		// key events
+	TASK_UI,		// clock, bar, footer, frame composition
+	TASK_COUNT
+};
+
+typedef void (*TASKFUNC)( void );
+
+typedef struct {
+	uint32_t runs;
+	uint32_t missed;		// runs started later than the deadline
+	uint64_t total;			// execution time of all runs [cycles]
+	uint32_t wcet;			// longest execution time [cycles]
+	uint32_t latency;		// longest release to start time [ms]
+} TASK_STATS;
+
+typedef struct {
+	const char *name;
+	TASKFUNC run;
+	uint16_t period;		// [ms], 0: only when signalled
+	uint16_t deadline;		// [ms] after release
+} TASK;
+
+void SCHED_Init( const TASK *table );
+void SCHED_Signal( uint8_t task );		// also from interrupts
+void SCHED_Run( void );
+const TASK *SCHED_GetTask( uint8_t task );
+const TASK_STATS *SCHED_GetStats( uint8_t task );
+void SCHED_ResetStats( void );
+
+#endif /* CORE_INC_SCHED_H_ */
@@ -8,12 +8,81 @@
 #ifndef CORE_INC_SCPI_H_
 #define CORE_INC_SCPI_H_
 
-int scpi_print( const char *fmt, ... );
+#include <stdint.h>
 
-void SCPI_CDC_RxCallback( uint8_t *Buf, uint16_t Len );
+#define SCPI_LINE_SIZE		100
+#define SCPI_QUEUE_SIZE		3		// command lines per session, received ahead of execution
+#define SCPI_CANCEL			0x18	// received byte: drop the line being assembled (USBTMC Bulk-OUT abort)
 
-char *SCPI_Execute( char *command );
+#define ESR_OPC				0x01	// standard event status: operation complete, after *OPC
+#define ESR_DDE				0x08	// standard event status: device dependent error, received bytes were lost
+#define ESR_EXE				0x10	// standard event status: execution error, READ? refused with TRIG:SOUR BUS
 
+#define STB_MAV				0x10	// status byte: message available, response waiting (USBTMC only)
+#define STB_ESB				0x20	// status byte: event status bit, ESR & ESE
+#define STB_MSS				0x40	// status byte: master summary status, STB & SRE, a service request
+
+enum {								// FORM:DATA
+	SCPI_FORMAT_ASCII,
+	SCPI_FORMAT_REAL32,
+	SCPI_FORMAT_REAL64,
+	SCPI_FORMAT_INT32
+};
+
+typedef struct {
+	char text[SCPI_LINE_SIZE];		// command line, parsed in place
+	uint8_t len;
+	uint8_t done;					// complete line waiting to be executed
+} SCPI_LINE;
+
+#define SCPI_STREAM_SYNC	0xA5	// first byte of a SCPI_RECORD
+#define SCPI_STREAM_FIRST	0x01	// SCPI_RECORD flags: first record after SYST:STR ON
+
+typedef struct {					// SYST:STR ON, one per reading, little endian
+	uint8_t sync;					// SCPI_STREAM_SYNC
+	uint8_t scale;					// SCALE_xxx
+	uint16_t seq;					// +1 per reading, also for the ones lost to overruns
+	uint32_t time;					// [ms] since power up
+	float value;					// [unit of the scale], +/-inf: overload
+	uint16_t overruns;				// readings lost so far, low 16 bits
+	uint8_t flags;					// SCPI_STREAM_xxx
+	uint8_t check;					// all bytes of the record add up to 0
+} __attribute__((__packed__)) SCPI_RECORD;
+
+typedef struct {					// one per transport
+	const char *name;
+	int (*getc)( void );									// next received byte, -1 if none
+	uint16_t (*write)( const uint8_t *buf, uint16_t len );	// never waits, returns the bytes taken
+	uint16_t (*writeFree)( void );							// bytes write() takes right now
+	void (*end)( void );									// response complete (USBTMC EOM), NULL for byte streams
+	uint8_t (*clear)( void );								// 1 once after a device clear, NULL if none
+	uint8_t (*lost)( void );								// 1 once after received bytes were lost, NULL if that cannot happen
+	void (*status)( uint8_t stb );							// status byte, every Do_SCPI() pass, NULL if not needed
+	uint8_t echo;											// echo parsed commands (debug)
+	SCPI_LINE queue[SCPI_QUEUE_SIZE];						// FIFO, the line behind the last complete one is being assembled
+	uint8_t head;											// line being executed
+	uint8_t count;											// complete lines
+	char *next;												// rest of the line at head, NULL: not started
+	uint8_t discard;										// drop received bytes up to the next '\n', after lost()
+	uint8_t opc;											// *OPC given, set ESR_OPC when the job is done
+	uint8_t esr;											// standard event status register, ESR_xxx
+	uint8_t ese;											// standard event status enable, *ESE
+	uint8_t sre;											// service request enable, *SRE
+	uint8_t format;											// SCPI_FORMAT_xxx of the readings
+	uint8_t swap;											// binary formats little endian (FORM:BORD SWAP)
+	uint8_t fetch;											// FETC? / READ? response pending: 1 header, 2 readings
+	uint8_t fetched;										// readings of it sent
+	char out[SCPI_LINE_SIZE];								// response buffer
+} SCPI_SESSION;
+
+int scpi_puts( const char *txt );
+
+void SCPI_RxCallback( void );
+
+char *SCPI_Execute( SCPI_SESSION *ses, char *command );		// one command, the line is split at ';' by Do_SCPI()
+
+void SCPI_Init( void );
+void SCPI_Stream( double val );
 void Do_SCPI( void );
 
 
@@ -0,0 +1,39 @@
+// Generated by Tools/scpihash.py from scpikw.c - do not edit
+
+#ifndef __SCPI_HASH_H_
+#define __SCPI_HASH_H_
+
+// 83 keywords, 138 forms
+
+#define SCPI_HASH_BASIS		2166136261UL
+#define SCPI_HASH_PRIME		16777619UL
+#define SCPI_HASH_BUCKETS	64
+#define SCPI_HASH_SLOTS		256
+
+const uint8_t scpi_hash_disp[] = {
+	0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+	1, 0, 1, 0, 0, 0, 0, 0, 4, 1, 0, 4, 2, 1, 0, 0,
+	0, 1, 2, 2, 0, 4, 0, 2, 1, 0, 2, 8, 6, 0, 1, 0,
+	1, 0, 0, 13, 8, 2, 0, 0, 16, 1, 2, 1, 4, 1, 2, 1,
+};
+
+const uint8_t scpi_hash_slot[] = {
+	11, 50, 34, 43, 70, 60, 64, 81, 63, 26, 79, 82, 25, 65, 22, 21,
+	255, 255, 26, 61, 56, 4, 20, 255, 255, 58, 255, 255, 255, 65, 26, 27,
+	78, 17, 54, 255, 255, 22, 255, 255, 0, 19, 64, 45, 255, 33, 255, 255,
+	75, 73, 68, 35, 255, 29, 14, 255, 255, 20, 255, 61, 255, 63, 255, 2,
+	255, 33, 255, 10, 76, 255, 255, 255, 255, 255, 255, 255, 45, 51, 57, 31,
+	255, 51, 77, 82, 255, 26, 255, 255, 255, 255, 255, 255, 28, 78, 60, 255,
+	18, 76, 255, 12, 19, 255, 23, 44, 23, 255, 66, 56, 255, 255, 16, 44,
+	52, 53, 55, 39, 40, 62, 255, 5, 255, 255, 21, 255, 27, 18, 11, 255,
+	58, 74, 255, 255, 255, 255, 37, 28, 255, 255, 73, 255, 255, 255, 255, 255,
+	35, 255, 36, 37, 255, 255, 67, 75, 77, 41, 43, 24, 255, 255, 255, 57,
+	255, 255, 255, 255, 49, 255, 30, 255, 255, 255, 255, 255, 255, 17, 6, 255,
+	10, 80, 67, 41, 34, 49, 32, 255, 255, 255, 255, 255, 25, 255, 255, 59,
+	255, 255, 255, 71, 255, 255, 255, 255, 255, 255, 24, 255, 255, 255, 255, 255,
+	8, 255, 48, 13, 255, 255, 255, 255, 12, 52, 68, 9, 48, 255, 42, 255,
+	53, 15, 255, 38, 255, 255, 70, 30, 255, 79, 3, 255, 66, 13, 69, 15,
+	255, 1, 255, 255, 38, 46, 255, 255, 255, 50, 255, 47, 71, 7, 72, 255,
+};
+
+#endif /* __SCPI_HASH_H_ */
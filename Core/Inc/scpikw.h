@@ -0,0 +1,103 @@
+/*
+ * scpikw.h
+ *
+ *  Created on: 19.10.2026
+ *      Author: aziemer
+ */
+
+#ifndef CORE_INC_SCPIKW_H_
+#define CORE_INC_SCPIKW_H_
+
+typedef enum {		// must be same order as scpi_keywords[] in scpikw.c !
+	SCPI_IDN,
+	SCPI_RST,
+	SCPI_OPC,		// missing in original software !!
+	SCPI_WAI,
+	SCPI_ESR,
+	SCPI_TRG,
+	SCPI_CLS,
+	SCPI_ESE,
+	SCPI_SRE,
+	SCPI_STB,
+	SCPI_SENS,
+	SCPI_CONF,
+	SCPI_CALC,
+	SCPI_SYST,
+	SCPI_AUTO,
+	SCPI_RANG,
+	SCPI_RATE,
+	SCPI_MEAS,
+	SCPI_FUNC,
+	SCPI_VOLT,
+	SCPI_CURR,
+	SCPI_FREQ,
+	SCPI_PER,
+	SCPI_CAP,
+	SCPI_CONT,
+	SCPI_DIOD,
+	SCPI_FRES,
+	SCPI_RES,
+	SCPI_TEMP,
+	SCPI_RTD,
+	SCPI_TYP,
+	SCPI_UNIT,
+	SCPI_SHOW,
+	SCPI_SCAL,
+	SCPI_THRE,
+	SCPI_AVER,
+	SCPI_ALL,
+	SCPI_MAX,
+	SCPI_MIN,
+	SCPI_DBM,
+	SCPI_DB,
+	SCPI_REF,
+	SCPI_NULL,
+	SCPI_OFFS,
+	SCPI_STAT,
+	SCPI_BEEP,
+	SCPI_DATE,
+	SCPI_TIME,
+	SCPI_LOC,
+	SCPI_REM,
+	SCPI_DEF,
+	SCPI_CAL,
+	SCPI_SEC,
+	SCPI_VAL,
+	SCPI_AC,
+	SCPI_DC,
+	SCPI_DISP,
+	SCPI_FILT,
+	SCPI_FRAM,
+	SCPI_TASK,
+	SCPI_INIT,
+	SCPI_FETC,
+	SCPI_READ,
+	SCPI_TRIG,
+	SCPI_SOUR,
+	SCPI_DEL,
+	SCPI_SAMP,
+	SCPI_COUN,
+	SCPI_IMM,
+	SCPI_BUS,
+	SCPI_ABOR,
+	SCPI_FORM,
+	SCPI_DATA,
+	SCPI_ASC,
+	SCPI_REAL,
+	SCPI_INT,
+	SCPI_BORD,
+	SCPI_NORM,
+	SCPI_SWAP,
+	SCPI_STR,
+	SCPI_ON,
+	SCPI_OFF,
+	SCPI_NONE,
+
+	SCPI_NUM_STRINGS
+} SCPI_STRINGS;
+
+extern const char * const scpi_keywords[];
+
+int SCPI_Match( const char *keyword );
+
+#endif /* CORE_INC_SCPIKW_H_ */
@@ -49,8 +49,12 @@ void TFT_setForeGround( uint16_t color );
 void TFT_setFont( uint8_t no );
 void TFT_setFontSize( uint8_t size );
 uint8_t TFT_getFontHeight( void );
+uint8_t TFT_getCharWidth( char c );
 size_t TFT_getStrWidth( char *txt );
+void TFT_putc( char c );
+void TFT_puts( const char *txt );
 int TFT_printf( const char *fmt, ... );
+void TFT_clearText( int x1, int x2 );
 
 void TFT_setXPos( uint16_t x );
 void TFT_setYPos( uint16_t y );
@@ -69,8 +73,22 @@ void TFT_fillCircle( int x, int y, int radius );
 
 void TFT_clearScreen( uint16_t color );
 
+void TFT_beginWindow( int x1, int y1, int x2, int y2 );
+void TFT_writeRun( uint16_t color, uint32_t count );
+void TFT_endWindow( void );
+
+void TFT_setScrollArea( uint16_t left, uint16_t width );
+void TFT_setScrollPos( uint16_t x );
+void TFT_resetScroll( void );
+
 void TFT_Init( void );
 
+//#define TFT_BENCHMARK			// measure glyph rendering speed on start-up
+
+#ifdef TFT_BENCHMARK
+void TFT_Benchmark( void );
+#endif
+
 // UTFT borrowed functions
 
 
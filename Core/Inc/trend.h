@@ -0,0 +1,19 @@
+/*
+ * trend.h
+ *
+ *  Created on: 19.10.2026
+ *      Author: aziemer
+ */
+
+#ifndef CORE_INC_TREND_H_
+#define CORE_INC_TREND_H_
+
+#include <stdint.h>
+
+void TREND_Start( void );
+void TREND_Stop( void );
+uint8_t TREND_isActive( void );
+
+void TREND_AddSample( int scale, double val );
+
+#endif /* CORE_INC_TREND_H_ */
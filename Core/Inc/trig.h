@@ -0,0 +1,40 @@
+/*
+ * trig.h
+ *
+ *  Created on: 19.10.2026
+ *      Author: aziemer
+ */
+
+#ifndef CORE_INC_TRIG_H_
+#define CORE_INC_TRIG_H_
+
+#include <stdint.h>
+
+#define TRIG_SAMPLES_MAX	100		// reading buffer [readings]
+#define TRIG_OVERLOAD		INT32_MAX	// +/- count of a reading out of the int32 range
+#define TRIG_OVERLOAD_VALUE	9.9e37		// SCPI overload reading
+
+enum {								// trigger sources
+	TRIG_IMMEDIATE,					// triggered by the initiate
+	TRIG_BUS						// *TRG
+};
+
+void TRIG_SetSource( uint8_t source );
+uint8_t TRIG_GetSource( void );
+void TRIG_SetDelay( uint16_t ms );
+uint16_t TRIG_GetDelay( void );
+void TRIG_SetCount( uint8_t samples );		// limited to 1 .. TRIG_SAMPLES_MAX
+uint8_t TRIG_GetCount( void );
+
+void TRIG_Initiate( uint8_t skip );		// clear the buffer and arm, skip: readings to drop after the trigger delay
+void TRIG_Bus( void );					// *TRG
+void TRIG_Abort( void );
+uint8_t TRIG_Busy( void );				// initiated, buffer not yet complete
+uint8_t TRIG_Readings( void );			// readings in the buffer
+int32_t TRIG_GetRaw( uint8_t i );		// [counts of TRIG_GetFactor()], +/-TRIG_OVERLOAD
+double TRIG_GetFactor( void );			// [unit/count], the display resolution of the scale at the initiate
+double TRIG_GetReading( uint8_t i );	// [unit], +/-TRIG_OVERLOAD_VALUE
+
+void TRIG_Reading( double val );		// acquisition task, every reading of channel 1
+
+#endif /* CORE_INC_TRIG_H_ */
@@ -19,10 +19,14 @@
 #include "gpio.h"
 #include "tft.h"
 #include "kbd.h"
+#include "sched.h"
 #include "scpi.h"
 
 #include "dmm.h"
 #include "calib.h"
+#include "trig.h"
+#include "trend.h"
+#include "numfmt.h"
 #include "application.h"
 
 /*
@@ -174,38 +178,148 @@ static const MENU Menus[] = {
 
 static const MENU *curMenu = NULL;
 
+typedef struct {
+	uint16_t xpos, ypos;			// base line origin of the field
+	uint16_t xend;					// right end of the text currently on screen
+	uint8_t valid;					// 0: screen content unknown, next draw is a full redraw
+	uint8_t error;					// field shows an OVER / OPEN / RANGE message in ERROR_FONT
+	char text[PREC+10];				// text currently on screen
+} VALUE_FIELD;
+
+static VALUE_FIELD value1 = { VALUE1_XPOS, VALUE1_YPOS };
+static VALUE_FIELD value2 = { VALUE2_XPOS, VALUE2_YPOS };
+
+static struct {
+	uint8_t lo, hi;					// lit segments [lo..hi) on screen
+	uint8_t valid;					// 0: screen content unknown
+	uint32_t count;					// nFastCount of the value shown
+	uint32_t time;					// HAL_GetTick() of the last update
+} bar = { 0, };
+
 static uint8_t hold = 0;
 static uint8_t autorange = 1;
 static uint8_t dualmode = 0;
 static uint8_t relmode = 0;
 static double relVal = 0;
 
-static void DrawTime( uint8_t force )
+/*
+ * Retained mode UI: every screen element is a widget with a dirty bit.
+ * State changes only invalidate widgets, Compose() repaints the dirty ones once per frame,
+ * in the order of this enum (i.e. the header before the time drawn on top of it).
+ *
+ * Frames start at the display refresh rate, independent of the measurement rate. A frame
+ * is rendered one widget per main loop pass, so acquisition and SCPI keep running while
+ * it is in flight. If the next frame is due before the current one is finished, it is
+ * dropped - the dirty widgets simply go into the frame after.
+ */
+enum {
+	W_HEADER,
+	W_TIME,
+	W_BUTTON1, W_BUTTON2, W_BUTTON3, W_BUTTON4, W_BUTTON5,
+	W_FOOTER,
+	W_UNITS,
+	W_VALUE,
+	W_BAR,
+	W_HOLD,
+	W_AUTO,
+	W_REL,
+	W_TREND,
+
+	W_COUNT
+};
+
+#define TREND_HIDES		( ( 1UL << W_TIME ) | ( 1UL << W_HEADER ) | ( 1UL << W_FOOTER ) | ( 1UL << W_UNITS ) | \
+						  ( 1UL << W_VALUE ) | ( 1UL << W_BAR ) | ( 1UL << W_HOLD ) | ( 1UL << W_AUTO ) | ( 1UL << W_REL ) )
+
+typedef struct {
+	void (*draw)( uint8_t arg );
+	uint8_t arg;					// passed to draw()
+} WIDGET;
+
+static uint32_t ui_dirty = 0;		// bit n: widget n needs repainting
+static uint32_t ui_hidden = 1UL << W_TREND;		// bit n: widget n is not on screen, stays dirty
+static uint32_t ui_frame = 0;		// widgets of the frame in flight, not yet drawn
+static FRAME_STATS ui_stats = { .budget = 1000000 / FRAME_RATE_DEFAULT };
+static uint8_t frameRate = FRAME_RATE_DEFAULT;
+static uint32_t frameDue = 0;		// HAL_GetTick() of the next frame
+static uint32_t frameTime = 0;		// render time of the frame in flight [cycles]
+static uint8_t frameWidgets = 0;
+
+static uint8_t remote = 0;			// 1: remote mode, screen frozen to the REMOTE banner
+
+static uint8_t displayFilter = 0;	// 1: show the mean of all readings since the last frame
+static double filterSum = 0;
+static uint16_t filterCount = 0;
+
+static uint32_t readings = 0;		// completed readings of channel 1
+
+static const char *shownLegend = NULL;				// header title on screen
+static const BUTTON *shownButton[5] = { NULL, };	// soft buttons on screen
+static char footerText[50] = "";					// default footer text
+
+typedef struct {
+	char text[40];
+	uint16_t time;					// [ms] to show, 0: slot free
+	uint32_t expires;				// HAL_GetTick() when shown
+	uint8_t prio;					// MSG_xxx
+	uint8_t seq;					// order of arrival
+} FOOTER_MSG;
+
+static FOOTER_MSG footerQueue[FOOTER_QUEUE];
+static FOOTER_MSG *footerShown = NULL;				// NULL: default text on screen
+
+static volatile uint8_t clockSecond = 0;	// counted by the RTC second interrupt, synced by DrawTime()
+static volatile uint8_t clockMinute = 0;	// 1: minute rolled over, clock needs a repaint
+
+static inline void Invalidate( uint8_t widget )
+{
+	ui_dirty |= 1UL << widget;
+}
+
+void HAL_RTCEx_RTCEventCallback( RTC_HandleTypeDef *rtc )	// RTC second interrupt
+{
+	if( ++clockSecond >= 60 )
+	{
+		clockSecond = 0;
+		clockMinute = 1;
+	}
+}
+
+static void CheckTime( void )		// invalidate the clock once per minute
+{
+	if( clockMinute )
+	{
+		clockMinute = 0;
+		Invalidate( W_TIME );
+	}
+}
+
+void ClockChanged( void )			// RTC has been set
+{
+	Invalidate( W_TIME );
+}
+
+static void DrawTime( uint8_t arg )
 {
 	const char *dayname[7] = { "Su", "Mo", "Tu", "We", "Th", "Fr", "Sa" };
 	RTC_DateTypeDef sDate;
 	RTC_TimeTypeDef sTime;
 	char tmp[30];
-	static uint8_t last_min = -1;
-
-	HAL_RTC_GetTime( &hrtc, &sTime, RTC_FORMAT_BIN );
-	if( last_min != sTime.Minutes || force )
-	{
-		HAL_RTC_GetDate( &hrtc, &sDate, RTC_FORMAT_BIN );
-		sprintf( tmp, "  %s %02d.%02d.%04d %02d:%02d", dayname[sDate.WeekDay%7], sDate.Date, sDate.Month, sDate.Year + 2000, sTime.Hours, sTime.Minutes );
 
-		TFT_setFont( TIME_FONT );
-		TFT_setXPos( TFT_WIDTH - TFT_getStrWidth( tmp ) - 7 );
-		TFT_setYPos( HEADER_HEIGHT - 9 );
-		TFT_setForeGround( TIME_COLOR );
-		TFT_setBackGround( HEADER_COLOR );
-		TFT_printf( tmp );
+	HAL_RTC_GetTime( &hrtc, &sTime, RTC_FORMAT_BIN );	// MUST read both time and date, and in this order !
+	HAL_RTC_GetDate( &hrtc, &sDate, RTC_FORMAT_BIN );
+	clockSecond = sTime.Seconds;		// re-sync the second counter
+	sprintf( tmp, "  %s %02d.%02d.%04d %02d:%02d", dayname[sDate.WeekDay%7], sDate.Date, sDate.Month, sDate.Year + 2000, sTime.Hours, sTime.Minutes );
 
-		last_min = sTime.Minutes;
-	}
+	TFT_setFont( TIME_FONT );
+	TFT_setXPos( TFT_WIDTH - TFT_getStrWidth( tmp ) - 7 );
+	TFT_setYPos( HEADER_HEIGHT - 9 );
+	TFT_setForeGround( TIME_COLOR );
+	TFT_setBackGround( HEADER_COLOR );
+	TFT_puts( tmp );
 }
 
-static void DrawHeader( void )
+static void DrawHeader( uint8_t arg )
 {
 	TFT_setForeGround( HEADER_COLOR );
 	TFT_fillRect( 0, 0, TFT_WIDTH-1, HEADER_HEIGHT-1 );
@@ -216,71 +330,166 @@ static void DrawHeader( void )
 	TFT_setYPos( HEADER_HEIGHT - 8 );
 	TFT_setForeGround( 0 );
 	TFT_setBackGround( HEADER_COLOR );
-	TFT_printf( curMenu->legend );
+	TFT_puts( curMenu->legend );
+
+	Invalidate( W_TIME );			// has just been overwritten
 }
 
-void DrawFooter( char *msg, ... )
+static void PaintFooter( const char *txt, uint16_t color )
 {
-	char txt[50];
-	uint32_t i;
-	va_list ap;
+	uint16_t ypos = BUTTON_YPOS( 4 );
+
+	TFT_setForeGround( color );
+	TFT_setBackGround( BACKGROUND_COLOR );
+	TFT_fillRoundRect( 2, ypos, BUTTON_XPOS - SPACING + 1, ypos + BUTTON_HEIGHT );
 
-	for(;;)
+	TFT_setFont( FOOTER_FONT );
+	TFT_setForeGround( FOOTER_TEXT_COLOR );
+	TFT_setBackGround( color );
+	TFT_setXPos( 10 );
+	TFT_setYPos( ypos + BUTTON_HEIGHT - ( BUTTON_HEIGHT - TFT_getFontHeight() ) / 2 - 2 );	// base-line !!
+	TFT_puts( txt );
+}
+
+static void DrawFooterWidget( uint8_t arg )
+{
+	if( footerShown )
+		PaintFooter( footerShown->text, ( footerShown->prio == MSG_ERROR ) ? WARNING_COLOR : FOOTER_COLOR );
+	else
+		PaintFooter( footerText, FOOTER_COLOR );
+}
+
+static void UpdateFooter( void )	// default footer shows the scale name
+{
+	const DMMDISP *disp = DMM_GetDisplay( DMM_GetScale( 1 ) );
+	const char *txt = disp ? disp->name : "";
+
+	if( strcmp( txt, footerText ) )
 	{
-		uint16_t ypos = BUTTON_YPOS( 4 );
+		strcpy( footerText, txt );
+		if( !footerShown )
+			Invalidate( W_FOOTER );
+	}
+}
 
-		if( msg )
-		{
-			va_start( ap, msg );
-			vsnprintf( txt, sizeof(txt), msg, ap );
-			va_end( ap );
+/*
+ * Footer messages replace the default footer text until they expire.
+ * The one shown is the oldest of the highest priority; its time only starts running when it
+ * gets on screen, and starts over if a message of higher priority takes its place meanwhile.
+ */
+static void CheckFooter( void )
+{
+	FOOTER_MSG *m, *next = NULL;
 
-			uint8_t len = strlen( txt );
-			while( ( len = TFT_getStrWidth( txt ) ) > BUTTON_XPOS - SPACING - 1 && i )			// truncate 1st line, if too long
-				txt[ i-1 ] = 0;
-		}
-		else
+	if( footerShown && (int32_t)( HAL_GetTick() - footerShown->expires ) >= 0 )
+		footerShown->time = 0;		// expired, free the slot
+
+	for( m = footerQueue; m < footerQueue + FOOTER_QUEUE; ++m )
+		if( m->time && ( !next || m->prio > next->prio || ( m->prio == next->prio && (int8_t)( m->seq - next->seq ) < 0 ) ) )
+			next = m;
+
+	if( next == footerShown )
+		return;
+
+	if( footerShown )
+		footerShown->expires = 0;	// expired or preempted
+	footerShown = next;
+	if( next )
+		next->expires = HAL_GetTick() + next->time;
+
+	Invalidate( W_FOOTER );
+}
+
+static void QueueFooter( uint8_t prio, uint16_t ms, const char *msg, va_list ap )
+{
+	static uint8_t seq = 0;
+	FOOTER_MSG *m, *slot = NULL;
+	uint16_t i;
+
+	if( remote )
+		return;
+
+	for( m = footerQueue; m < footerQueue + FOOTER_QUEUE; ++m )		// free slot, or else the least important, oldest one
+	{
+		if( !m->time )
 		{
-			int scale = DMM_GetScale( 1 );
-			DMM_GetScaleUnit( scale, NULL, NULL, NULL, txt );
+			slot = m;
+			break;
 		}
+		if( !slot || m->prio < slot->prio || ( m->prio == slot->prio && (int8_t)( m->seq - slot->seq ) < 0 ) )
+			slot = m;
+	}
 
-		TFT_setForeGround( FOOTER_COLOR );
-		TFT_setBackGround( BACKGROUND_COLOR );
-		TFT_fillRoundRect( 2, ypos, BUTTON_XPOS - SPACING + 1, ypos + BUTTON_HEIGHT );
+	if( slot->time )
+	{
+		if( slot->prio > prio )		// queue full of more important messages
+			return;
+		if( slot == footerShown )
+			footerShown = NULL;
+	}
 
-		TFT_setFont( FOOTER_FONT );
-		TFT_setForeGround( FOOTER_TEXT_COLOR );
-		TFT_setBackGround( FOOTER_COLOR );
-		TFT_setXPos( 10 );
-		TFT_setYPos( BUTTON_YPOS( 4 ) + BUTTON_HEIGHT - ( BUTTON_HEIGHT - TFT_getFontHeight() ) / 2 - 2 );	// base-line !!
-		TFT_printf( txt );
+	vsnprintf( slot->text, sizeof(slot->text), msg, ap );
 
-		if( !msg )
-			return;
+	TFT_setFont( FOOTER_FONT );
+	i = strlen( slot->text );
+	while( TFT_getStrWidth( slot->text ) > BUTTON_XPOS - SPACING - 1 && i )		// truncate, if too long
+		slot->text[ --i ] = 0;
 
-		msg = NULL;
+	slot->prio = prio;
+	slot->seq = seq++;
+	slot->time = ms ? ms : 1;
+	slot->expires = 0;
 
-		for( i = 0; i < 0x500000; ++i )
-			asm volatile ("nop");
+	CheckFooter();
+}
+
+void FooterMessage( uint8_t prio, uint16_t ms, const char *msg, ... )	// show msg for ms [ms]
+{
+	va_list ap;
+
+	va_start( ap, msg );
+	QueueFooter( prio, ms, msg, ap );
+	va_end( ap );
+}
+
+void DrawFooter( char *msg, ... )
+{
+	va_list ap;
+
+	va_start( ap, msg );
+	QueueFooter( MSG_INFO, FOOTER_MSG_TIME, msg, ap );
+	va_end( ap );
+}
+
+void ClearFooter( void )		// drop all messages, back to the default text
+{
+	FOOTER_MSG *m;
+
+	for( m = footerQueue; m < footerQueue + FOOTER_QUEUE; ++m )
+		m->time = 0;
+
+	if( footerShown )
+	{
+		footerShown = NULL;
+		Invalidate( W_FOOTER );
 	}
 }
 
-static uint8_t format_value( char *str, char spc, double Val, double fullscale, uint8_t scale )
+static uint8_t format_value( char *str, char spc, double Val, const DMMDISP *disp )	// Val in disp->unit
 {
 	if( DMM_isNAN( Val ) || Val == +INFINITY || Val == -INFINITY )
 	{
-		strcpy( str, DMM_isCONT( scale ) ? "OPEN " : "OVER " );
+		strcpy( str, ( disp->flags & DISP_CONT ) ? "OPEN " : "OVER " );
 		return ERRVAL_CMD_VALFORMAT;
 	}
 #if 1
-	if( abs( Val ) > 1.1 * fullscale )
+	if( fabs( Val ) > 1.1 * disp->fullscale )
 	{
 		strcpy( str, "RANGE " );
 		return ERRVAL_CMD_VALFORMAT;
 	}
 #endif
-	else if( DMM_isDIOD( scale ) && Val > DMM_DIODEOPENTHRESHOLD )
+	else if( ( disp->flags & DISP_DIOD ) && Val > DMM_DIODEOPENTHRESHOLD )
 	{
 		strcpy( str, "OPEN " );
 		return 1;
@@ -290,7 +499,7 @@ static uint8_t format_value( char *str, char spc, double Val, double fullscale,
 		char tmp[20];
 		uint8_t dot, l, i, pos;
 
-		l = sprintf( tmp, DMM_GetFormat( scale ), Val );
+		l = NUM_Format( tmp, Val, &disp->fmt );
 
 		for( dot = 0; ( dot < l ) && ( tmp[dot] != '.' ); ++dot )
 			;
@@ -328,24 +537,154 @@ static uint8_t format_value( char *str, char spc, double Val, double fullscale,
 	return ERRVAL_SUCCESS;
 }
 
-static void DrawValue( void )
+static void InvalidateValues( void )	// value area has been cleared, next draw must redraw all digits
+{
+	value1.valid = value1.error = 0;
+	value2.valid = value2.error = 0;
+	bar.valid = 0;
+	Invalidate( W_BAR );
+}
+
+static void DrawSegments( uint8_t from, uint8_t to )	// segments [from..to) in their current state, one window
+{
+	uint8_t row, i;
+
+	if( from >= to )
+		return;
+
+	TFT_beginWindow( BAR_XPOS + from * ( BAR_SEGMENT_WIDTH + 1 ), BAR_YPOS,
+					 BAR_XPOS + to * ( BAR_SEGMENT_WIDTH + 1 ) - 1, BAR_YPOS + BAR_HEIGHT - 1 );
+
+	for( row = 0; row < BAR_HEIGHT; ++row )
+	{
+		for( i = from; i < to; ++i )
+		{
+			TFT_writeRun( ( i >= bar.lo && i < bar.hi ) ? BAR_ON_COLOR : BAR_OFF_COLOR, BAR_SEGMENT_WIDTH );
+			TFT_writeRun( BACKGROUND_COLOR, 1 );
+		}
+	}
+
+	TFT_endWindow();
+}
+
+/*
+ * Bar graph over the range of the current scale (zero in the middle for DC).
+ * Only the segments between the old and the new end of the bar are repainted.
+ */
+static void DrawBar( uint8_t arg )
+{
+	int scale = DMM_GetScale( 1 );
+	double fs = DMM_GetRange( scale );
+	uint8_t lo, hi, oldLo = bar.lo, oldHi = bar.hi;
+	int16_t n;
+
+	bar.count = nFastCount;
+	bar.time = HAL_GetTick();
+
+	if( DMM_isNAN( dFastVal ) || fs <= 0 )
+		n = 0;
+	else if( DMM_isDC( scale ) )
+		n = ( dFastVal / fs ) * ( BAR_SEGMENTS / 2 ) + ( dFastVal < 0 ? -0.5 : 0.5 );
+	else
+		n = ( dFastVal / fs ) * BAR_SEGMENTS + 0.5;
+
+	if( DMM_isDC( scale ) )
+	{
+		if( n > BAR_SEGMENTS / 2 ) n = BAR_SEGMENTS / 2;
+		if( n < -BAR_SEGMENTS / 2 ) n = -BAR_SEGMENTS / 2;
+		lo = ( n < 0 ) ? BAR_SEGMENTS / 2 + n : BAR_SEGMENTS / 2;
+		hi = ( n < 0 ) ? BAR_SEGMENTS / 2 : BAR_SEGMENTS / 2 + n;
+	}
+	else
+	{
+		if( n > BAR_SEGMENTS ) n = BAR_SEGMENTS;
+		if( n < 0 ) n = 0;
+		lo = 0;
+		hi = n;
+	}
+
+	bar.lo = lo;
+	bar.hi = hi;
+
+	if( !bar.valid )
+	{
+		DrawSegments( 0, BAR_SEGMENTS );
+		bar.valid = 1;
+		return;
+	}
+
+	// both ranges touch the zero segment, so the changes are at most two runs
+	DrawSegments( lo < oldLo ? lo : oldLo, lo < oldLo ? oldLo : lo );
+	DrawSegments( hi < oldHi ? hi : oldHi, hi < oldHi ? oldHi : hi );
+}
+
+static void CheckBar( void )		// new single conversion, and time for the next bar update?
+{
+	if( !hold && bar.count != nFastCount && HAL_GetTick() - bar.time >= BAR_INTERVAL )
+		Invalidate( W_BAR );
+}
+
+/*
+ * Draw a value string into a field, using the current font and colors.
+ * Only character cells whose glyph or position changed since the last call are redrawn,
+ * the tail of a previously longer text is cleared.
+ */
+static void DrawField( VALUE_FIELD *f, const char *txt )
+{
+	const char *old = f->valid ? f->text : "";
+	uint16_t x = f->xpos, xold = f->xpos;
+	char *dst = f->text;
+
+	TFT_setYPos( f->ypos );
+
+	while( *txt && dst < f->text + sizeof(f->text) - 1 )
+	{
+		uint8_t w = TFT_getCharWidth( *txt );
+
+		if( *old != *txt || xold != x )		// glyph or position changed
+		{
+			TFT_setXPos( x );
+			TFT_putc( *txt );
+		}
+
+		if( *old )
+			xold += TFT_getCharWidth( *old++ );
+
+		x += w;
+		*dst++ = *txt++;
+	}
+	*dst = 0;
+
+	if( f->valid && f->xend > x )			// new text is shorter
+		TFT_clearText( x, f->xend );
+
+	f->xend = x;
+	f->valid = 1;
+	f->error = 0;
+}
+
+static void DrawValue( uint8_t arg )
 {
 	uint8_t scale, pbErr;
-	double dScaleFact, dFullScale, Val;
+	const DMMDISP *disp;
+	double Val;
 	char szValue[PREC+10] = "";
-	char szUnitPrefix[10] = "";
 
 	if( hold ) return;
 
 	scale = DMM_GetScale( 1 );
+	disp = DMM_GetDisplay( scale );
 
-	pbErr = DMM_isScale( scale );
-	if( pbErr == ERRVAL_SUCCESS )
-		pbErr = DMM_GetScaleUnit( scale, &dScaleFact, szUnitPrefix, NULL, NULL );
-
-	if( pbErr == ERRVAL_SUCCESS )
+	if( disp )
 	{
-		Val = dMeasuredVal[0] * dScaleFact;
+		if( displayFilter && filterCount )
+			Val = filterSum / filterCount;	// mean of the readings since the last frame
+		else
+			Val = dMeasuredVal[0];
+		filterSum = 0;
+		filterCount = 0;
+
+		Val *= disp->factor;
 		if( relmode == 1 )
 		{
 			relVal = Val;
@@ -354,28 +693,41 @@ static void DrawValue( void )
 		else if( relmode == 2 )
 			Val -= relVal;
 
-		dFullScale = DMM_GetRange( scale ) * dScaleFact;
-
-		TFT_setFont( VALUE1_FONT );
-		TFT_setForeGround( VALUE1_COLOR );
-		TFT_setBackGround( BACKGROUND_COLOR );
-		TFT_setXPos( VALUE1_XPOS );
-		TFT_setYPos( VALUE1_YPOS );
+		pbErr = format_value( szValue, ',', Val, disp );
+		if( pbErr != ERRVAL_SUCCESS )	// OVER / OPEN / RANGE
+		{
+			if( !value1.error || strcmp( value1.text, szValue ) )	// message not yet on screen
+			{
+				TFT_setForeGround( BACKGROUND_COLOR );
+				TFT_fillRect( VALUE1_XPOS, VALUE1_YPOS - 50, UNIT1_XPOS - 2, VALUE1_YPOS + 10 );
 
-		pbErr = format_value( szValue, ',', Val, dFullScale, scale );
-		if( pbErr != ERRVAL_SUCCESS )	// OVER / OPEN
+				TFT_setForeGround( VGA_RED );
+				TFT_setBackGround( BACKGROUND_COLOR );
+				TFT_setFont( ERROR_FONT );
+				TFT_setFontSize( ERROR_FONT_SIZE );
+				TFT_setXPos( VALUE1_XPOS + 75 );
+				TFT_setYPos( VALUE1_YPOS - 5 );
+				TFT_puts( szValue );
+				TFT_setFontSize( 1 );
+
+				strcpy( value1.text, szValue );
+				value1.valid = value1.error = 1;
+			}
+		}
+		else
 		{
-			TFT_setForeGround( BACKGROUND_COLOR );
-			TFT_fillRect( VALUE1_XPOS, VALUE1_YPOS - 50, UNIT1_XPOS - 2, VALUE1_YPOS  );
+			if( value1.error )			// remove the error message first
+			{
+				TFT_setForeGround( BACKGROUND_COLOR );
+				TFT_fillRect( VALUE1_XPOS, VALUE1_YPOS - 50, UNIT1_XPOS - 2, VALUE1_YPOS + 10 );
+				value1.valid = value1.error = 0;
+			}
 
-			TFT_setForeGround( VGA_RED );
-			TFT_setFont( ERROR_FONT );
-			TFT_setFontSize( ERROR_FONT_SIZE );
-			TFT_setXPos( VALUE1_XPOS + 75 );
-			TFT_setYPos( VALUE1_YPOS - 5 );
+			TFT_setFont( VALUE1_FONT );
+			TFT_setForeGround( VALUE1_COLOR );
+			TFT_setBackGround( BACKGROUND_COLOR );
+			DrawField( &value1, szValue );
 		}
-		TFT_printf( szValue );
-		TFT_setFontSize( 1 );
 	}
 
 //	if( pbErr == ERRVAL_SUCCESS )
@@ -408,7 +760,8 @@ static void DrawValue( void )
 
 		TFT_setXPos( VALUE2_XPOS + 150 );
 		TFT_setYPos( VALUE2_YPOS + 60 );
-		TFT_printf( "%11.2f  ", (double)currCTC / currCTB );
+		NUM_Fixed( szValue, NUM_Round( (double)currCTC / currCTB, 2 ), 2, 11, 0 );
+		TFT_puts( szValue );
 #else
 		if( dualmode )
 		{
@@ -417,15 +770,13 @@ static void DrawValue( void )
 			TFT_setBackGround( BACKGROUND_COLOR );
 
 			if( scale == SCALE_FREQ )
-				snprintf( szValue, 9, "%5.1f  ", dMeasuredVal[1] );		// duty cycle
+				NUM_Fixed( szValue, NUM_Round( dMeasuredVal[1], 1 ), 1, 5, 0 );		// duty cycle
 			else if( DMM_isAC( scale ) )
-				snprintf( szValue, 9, "%5.0f  ", dMeasuredVal[1] );		// frequency
+				NUM_Fixed( szValue, NUM_Round( dMeasuredVal[1], 0 ), 0, 5, 0 );		// frequency
 			else
-				sprintf( szValue, "-" );
+				strcpy( szValue, "-" );
 
-			TFT_setXPos( VALUE2_XPOS );
-			TFT_setYPos( VALUE2_YPOS );
-			TFT_printf( szValue );
+			DrawField( &value2, szValue );
 		}
 #if 0
 		if( dualmode == 2 )
@@ -434,19 +785,17 @@ static void DrawValue( void )
 			TFT_setForeGround( VALUE3_COLOR );
 			TFT_setBackGround( BACKGROUND_COLOR );
 
-			pbErr = DMM_GetScaleUnit( 1, &dScaleFact, szUnitPrefix, NULL, NULL );
-			if( pbErr == ERRVAL_SUCCESS )
+			if( disp )
 			{
-				dFullScale = DMM_GetRange( scale ) * dScaleFact;
-				Val = dMeasuredVal[2] * dScaleFact;
-				pbErr = format_value( szValue, ' ', Val, dFullScale, scale );
+				Val = dMeasuredVal[2] * disp->factor;
+				pbErr = format_value( szValue, ' ', Val, disp );
 			}
 			else
 				sprintf( szValue, " ..... " );
 
 			TFT_setXPos( VALUE3_XPOS );
 			TFT_setYPos( VALUE3_YPOS );
-			TFT_printf( szValue );
+			TFT_puts( szValue );
 		}
 # endif
 
@@ -456,9 +805,6 @@ static void DrawValue( void )
 
 void SetHold( int mode )
 {
-	while( KBD_Read() )					// wait until released
-		;
-
 	switch( mode )
 	{
 	case 1:		hold = 1; break;
@@ -466,19 +812,11 @@ void SetHold( int mode )
 	default:	hold = !hold; break;
 	}
 
-	TFT_setFont( INDICATOR_FONT );
-	TFT_setForeGround( hold ? INDICATOR_ON_COLOR : INDICATOR_OFF_COLOR );
-	TFT_setBackGround( BACKGROUND_COLOR );
-	TFT_setXPos( HOLD_XPOS );
-	TFT_setYPos( HOLD_YPOS );
-	TFT_printf( "HOLD" );
+	Invalidate( W_HOLD );
 }
 
 void SetAuto( int mode )
 {
-	while( KBD_Read() )					// wait until released
-		;
-
 	switch( mode )
 	{
 	case 1:		autorange = 1; break;
@@ -486,19 +824,11 @@ void SetAuto( int mode )
 	default:	autorange = !autorange; break;
 	}
 
-	TFT_setFont( INDICATOR_FONT );
-	TFT_setForeGround( autorange ? INDICATOR_ON_COLOR : BACKGROUND_COLOR );
-	TFT_setBackGround( BACKGROUND_COLOR );
-	TFT_setXPos( BUTTON_XPOS - TFT_getStrWidth( "HOLD" ) - 10 );
-	TFT_setYPos( AUTO_YPOS );
-	TFT_printf( "AUTO" );
+	Invalidate( W_AUTO );
 }
 
 static void SetRelMode( uint8_t which, int state )
 {
-	while( KBD_Read() )					// wait until released
-		;
-
 	switch( state )
 	{
 	case 1:		relmode = 1; break;
@@ -506,12 +836,37 @@ static void SetRelMode( uint8_t which, int state )
 	default:	relmode = !relmode; break;
 	}
 
+	Invalidate( W_REL );
+}
+
+static void DrawIndicator( uint8_t which )
+{
 	TFT_setFont( INDICATOR_FONT );
-	TFT_setForeGround( relmode ? INDICATOR_ON_COLOR : BACKGROUND_COLOR );
 	TFT_setBackGround( BACKGROUND_COLOR );
-	TFT_setXPos( HOLD_XPOS );
-	TFT_setYPos( HOLD_YPOS + 20 );
-	TFT_printf( "REL" );
+
+	switch( which )
+	{
+	case W_HOLD:
+		TFT_setForeGround( hold ? INDICATOR_ON_COLOR : INDICATOR_OFF_COLOR );
+		TFT_setXPos( HOLD_XPOS );
+		TFT_setYPos( HOLD_YPOS );
+		TFT_puts( "HOLD" );
+		break;
+
+	case W_AUTO:
+		TFT_setForeGround( autorange ? INDICATOR_ON_COLOR : BACKGROUND_COLOR );
+		TFT_setXPos( BUTTON_XPOS - TFT_getStrWidth( "HOLD" ) - 10 );
+		TFT_setYPos( AUTO_YPOS );
+		TFT_puts( "AUTO" );
+		break;
+
+	case W_REL:
+		TFT_setForeGround( relmode ? INDICATOR_ON_COLOR : BACKGROUND_COLOR );
+		TFT_setXPos( HOLD_XPOS );
+		TFT_setYPos( HOLD_YPOS + 20 );
+		TFT_puts( "REL" );
+		break;
+	}
 }
 
 static void SetTempUnits( uint8_t which, int state )
@@ -526,107 +881,123 @@ static void SetTempUnits( uint8_t which, int state )
 		}
 	}
 	DMM_SetTempUnits( which );
+	Invalidate( W_UNITS );
 }
 
-static void DoMenu( int mode )	// no = -1: reload current menu
+static void DrawButton( uint8_t no )
 {
-	char tmp1[10], tmp2[10];
-	uint8_t no;
+	const BUTTON *button = &curMenu->button[no];
+	uint16_t ypos = BUTTON_YPOS( no );
+	char tmp1[10] = "", tmp2[10] = "";
+	size_t len;
 
-	if( mode < 0 )
-		mode = DMM_GetMode( DMM_GetScale( 1 ) );
-	else if( mode >= DMM_CNTMODES )
-		return;
+	TFT_setForeGround( BUTTON_COLOR );
+	TFT_setBackGround( BACKGROUND_COLOR );
+	TFT_fillRoundRect( BUTTON_XPOS, ypos, TFT_WIDTH-1, ypos + BUTTON_HEIGHT );
 
-	while( KBD_Read() )					// wait until released
-		;
+	TFT_setForeGround( BUTTON_TEXT_COLOR );
+	TFT_setBackGround( BUTTON_COLOR );
 
-	curMenu = &Menus[mode];
+	if( button->legend1 ) strcpy( tmp1, button->legend1 );
+	if( button->legend2 ) strcpy( tmp2, button->legend2 );
 
-	// Draw BUTTONS
-	for( no = 0; no < 5; ++no )
+	if( tmp2[0] == 0 )						// single line
 	{
-		uint16_t ypos = BUTTON_YPOS( no );
-		size_t len;
-
-		TFT_setForeGround( BUTTON_COLOR );
-		TFT_setBackGround( BACKGROUND_COLOR );
-		TFT_fillRoundRect( BUTTON_XPOS, ypos, TFT_WIDTH-1, ypos + BUTTON_HEIGHT );
-
-		TFT_setForeGround( BUTTON_TEXT_COLOR );
-		TFT_setBackGround( BUTTON_COLOR );
-
-		strcpy( tmp1, curMenu->button[no].legend1 );
-		strcpy( tmp2, curMenu->button[no].legend2 );
-
-		if( tmp2[0] == 0 )						// single line
+		TFT_setFont( BUTTON_FONT1 );
+		len = TFT_getStrWidth( tmp1 );
+		if( len > BUTTON_WIDTH - 2 )		// shrink font size, if too long
 		{
-			TFT_setFont( BUTTON_FONT1 );
+			TFT_setFont( BUTTON_FONT2 );
 			len = TFT_getStrWidth( tmp1 );
-			if( len > BUTTON_WIDTH - 2 )		// shrink font size, if too long
+			if( len > BUTTON_WIDTH - 2 )	// still too long, try wrapping
 			{
-				TFT_setFont( BUTTON_FONT2 );
-				len = TFT_getStrWidth( tmp1 );
-				if( len > BUTTON_WIDTH - 2 )	// still too long, try wrapping
+				uint8_t c, l = strlen( tmp1 );
+				for( c = 0; c < l; ++c )
 				{
-					uint8_t c, l = strlen( tmp1 );
-					for( c = 0; c < l; ++c )
+					if( tmp1[c] < '0' )
 					{
-						if( tmp1[c] < '0' )
-						{
-							strcpy( tmp2, tmp1 + c + 1 );
-							if( tmp1[c] == ' ' )
-								tmp1[c] = 0;
-							else
-								tmp1[c+1] = 0;
-							break;
-						}
+						strcpy( tmp2, tmp1 + c + 1 );
+						if( tmp1[c] == ' ' )
+							tmp1[c] = 0;
+						else
+							tmp1[c+1] = 0;
+						break;
 					}
-					goto DUAL_LINE;
 				}
+				goto DUAL_LINE;
 			}
-
-			TFT_setXPos( BUTTON_XPOS + ( BUTTON_WIDTH - len ) / 2 );
-			TFT_setYPos( ypos + BUTTON_HEIGHT - ( BUTTON_HEIGHT - TFT_getFontHeight() ) / 2 - 4 );
-			TFT_printf( tmp1 );
-			continue;
 		}
 
+		TFT_setXPos( BUTTON_XPOS + ( BUTTON_WIDTH - len ) / 2 );
+		TFT_setYPos( ypos + BUTTON_HEIGHT - ( BUTTON_HEIGHT - TFT_getFontHeight() ) / 2 - 4 );
+		TFT_puts( tmp1 );
+		return;
+	}
+
 DUAL_LINE:
 
-		TFT_setFont( BUTTON_FONT2 );
+	TFT_setFont( BUTTON_FONT2 );
 
-		uint8_t i = strlen( tmp1 );
-		while( ( len = TFT_getStrWidth( tmp1 ) ) > BUTTON_WIDTH-1 && i )			// truncate 1st line, if too long
-			tmp1[ i-1 ] = 0;
+	uint8_t i = strlen( tmp1 );
+	while( ( len = TFT_getStrWidth( tmp1 ) ) > BUTTON_WIDTH-1 && i )			// truncate 1st line, if too long
+		tmp1[ --i ] = 0;
 
-		TFT_setXPos( BUTTON_XPOS + ( BUTTON_WIDTH - len ) / 2 );
-		TFT_setYPos( ypos + BUTTON_HEIGHT / 2 - ( BUTTON_HEIGHT - TFT_getFontHeight() ) / 2 + 9 );
-		TFT_printf( tmp1 );
+	TFT_setXPos( BUTTON_XPOS + ( BUTTON_WIDTH - len ) / 2 );
+	TFT_setYPos( ypos + BUTTON_HEIGHT / 2 - ( BUTTON_HEIGHT - TFT_getFontHeight() ) / 2 + 9 );
+	TFT_puts( tmp1 );
 
-		i = strlen( tmp2 );
-		while( ( len = TFT_getStrWidth( tmp2 ) ) > BUTTON_WIDTH-1 && i )			// truncate 2nd line, if too long
-			tmp2[ i-1 ] = 0;
+	i = strlen( tmp2 );
+	while( ( len = TFT_getStrWidth( tmp2 ) ) > BUTTON_WIDTH-1 && i )			// truncate 2nd line, if too long
+		tmp2[ --i ] = 0;
 
-		if( curMenu->button[no].legend2[0] )	// if dual line, overlay 2nd background
-		{
-			TFT_setForeGround( BUTTON_VALUE_COLOR );
-			TFT_fillRoundRect( BUTTON_XPOS, ypos + BUTTON_HEIGHT / 2, TFT_WIDTH-1, ypos + BUTTON_HEIGHT );
+	if( button->legend2 && button->legend2[0] )	// if dual line, overlay 2nd background
+	{
+		TFT_setForeGround( BUTTON_VALUE_COLOR );
+		TFT_fillRoundRect( BUTTON_XPOS, ypos + BUTTON_HEIGHT / 2, TFT_WIDTH-1, ypos + BUTTON_HEIGHT );
 
-			TFT_setForeGround( BUTTON_TEXT_COLOR );
-			TFT_setBackGround( BUTTON_VALUE_COLOR );
-		}
+		TFT_setForeGround( BUTTON_TEXT_COLOR );
+		TFT_setBackGround( BUTTON_VALUE_COLOR );
+	}
 
-		TFT_setXPos( BUTTON_XPOS + ( BUTTON_WIDTH - len ) / 2 );
-		TFT_setYPos( ypos + BUTTON_HEIGHT - ( BUTTON_HEIGHT - TFT_getFontHeight() ) / 2 + 9 );
-		TFT_printf( tmp2 );
+	TFT_setXPos( BUTTON_XPOS + ( BUTTON_WIDTH - len ) / 2 );
+	TFT_setYPos( ypos + BUTTON_HEIGHT - ( BUTTON_HEIGHT - TFT_getFontHeight() ) / 2 + 9 );
+	TFT_puts( tmp2 );
+}
+
+static uint8_t SameLegend( const char *a, const char *b )
+{
+	if( !a || !b )
+		return a == b;
+	return !strcmp( a, b );
+}
+
+static void DoMenu( int mode )	// no = -1: reload current menu
+{
+	uint8_t no;
+
+	if( mode < 0 )
+		mode = DMM_GetMode( DMM_GetScale( 1 ) );
+	else if( mode >= DMM_CNTMODES )
+		return;
+
+	curMenu = &Menus[mode];
+
+	if( shownLegend != curMenu->legend )
+	{
+		shownLegend = curMenu->legend;
+		Invalidate( W_HEADER );
 	}
 
-	DrawHeader();
-	DrawFooter( NULL );
-	DrawTime( 1 );
+	for( no = 0; no < 5; ++no )			// only buttons with a different legend need repainting
+	{
+		const BUTTON *old = shownButton[no], *new = &curMenu->button[no];
 
-	SetAuto( autorange );					// redraw AUTO message
+		if( !old || !SameLegend( old->legend1, new->legend1 ) || !SameLegend( old->legend2, new->legend2 ) )
+			Invalidate( W_BUTTON1 + no );
+		shownButton[no] = new;
+	}
+
+	UpdateFooter();
 }
 
 static void MenuFunction( uint8_t no )		// soft buttons below the display
@@ -635,7 +1006,69 @@ static void MenuFunction( uint8_t no )		// soft buttons below the display
 	if( --no < 5 && curMenu->button[no].callback )
 		curMenu->button[no].callback( curMenu->button[no].cbChannel, curMenu->button[no].cbValue );
 
-	DoMenu( -1 );							// redraw current menu with possibly changed parameters
+	DoMenu( -1 );							// update current menu with possibly changed parameters
+}
+
+static void DrawUnits( uint8_t arg )	// clears the value area, draws the unit(s) of the current scale
+{
+	int scale = DMM_GetScale( 1 );
+	const DMMDISP *disp = DMM_GetDisplay( scale );
+	const char *unit2;
+	uint16_t xpos = UNIT1_XPOS;
+
+	if( !disp )
+		return;
+
+	if( disp->flags & DISP_FREQ )
+		xpos += 40;
+
+	TFT_setForeGround( BACKGROUND_COLOR );
+	TFT_fillRect( 0, AUTO_YPOS + 6, BUTTON_XPOS - 5, BUTTON_YPOS(4) - 5 );
+	InvalidateValues();
+
+	TFT_setFont( UNIT1_FONT );
+	TFT_setForeGround( UNIT1_COLOR );
+	TFT_setBackGround( BACKGROUND_COLOR );
+	TFT_setXPos( xpos );
+	TFT_setYPos( UNIT1_YPOS );
+	TFT_puts( disp->unit );
+
+	TFT_setForeGround( BACKGROUND_COLOR );
+	TFT_fillRect( TFT_getXPos(), TFT_getYPos() - TFT_getFontHeight(), BUTTON_XPOS - 10, TFT_getYPos() + 10 );	// must be TOP/LEFT -> BOTTOM/RIGHT
+
+	if( dualmode )
+	{
+		if( disp->flags & DISP_FREQ )
+			unit2 = "%";								// duty cycle
+		else if( disp->flags & DISP_AC )
+			unit2 = DMM_GetDisplay( SCALE_FREQ )->unit;	// frequency
+		else
+			unit2 = "";
+
+		TFT_setForeGround( UNIT2_COLOR );
+		TFT_setBackGround( BACKGROUND_COLOR );
+		TFT_setXPos( UNIT2_XPOS );
+		TFT_setYPos( UNIT2_YPOS );
+		TFT_puts( unit2 );
+
+		TFT_setForeGround( BACKGROUND_COLOR );
+		TFT_fillRect( TFT_getXPos(), TFT_getYPos() - TFT_getFontHeight(), BUTTON_XPOS - 10, TFT_getYPos() + 10 );	// must be TOP/LEFT -> BOTTOM/RIGHT
+	}
+#if 0
+	if( dualmode == 2 )
+	{
+		TFT_setForeGround( UNIT3_COLOR );
+		TFT_setBackGround( BACKGROUND_COLOR );
+		TFT_setXPos( UNIT3_XPOS );
+		TFT_setYPos( UNIT3_YPOS );
+		TFT_puts( disp->unit );
+
+		TFT_setForeGround( BACKGROUND_COLOR );
+		TFT_fillRect( TFT_getXPos(), TFT_getYPos() - TFT_getFontHeight(), BUTTON_XPOS - 10, TFT_getYPos() + 10 );	// must be TOP/LEFT -> BOTTOM/RIGHT
+	}
+#endif
+
+	Invalidate( W_REL );			// partly cleared
 }
 
 void SetScale( uint8_t channel, int scale )
@@ -731,86 +1164,18 @@ void SetScale( uint8_t channel, int scale )
 
 	if( err == ERRVAL_SUCCESS )
 	{
-		double dScaleFact;
-		char szUnitPrefix[50] = "", szUnit[50] = "";
-
 		if( scale > -1 )
 		{
-			uint16_t xpos = UNIT1_XPOS;
 			curMode = DMM_GetMode( scale );
-			if( curMode == DmmFrequency )
-			{
-				dualmode = 1;
-				xpos += 40;
-			}
-			else if( DMM_isAC( scale ) )
+			if( curMode == DmmFrequency || DMM_isAC( scale ) )
 				dualmode = 1;
 			else
 				dualmode = 0;
 
-			TFT_setForeGround( BACKGROUND_COLOR );
-			TFT_fillRect( 0, AUTO_YPOS + 6, BUTTON_XPOS - 5, BUTTON_YPOS(4) - 5 );
+			Invalidate( W_UNITS );
+			filterSum = 0;				// readings of the old scale
+			filterCount = 0;
 
-			err = DMM_GetScaleUnit( scale, &dScaleFact, szUnitPrefix, szUnit, NULL );
-			if( err == ERRVAL_SUCCESS )
-				strcat( szUnitPrefix, szUnit );
-
-			TFT_setFont( UNIT1_FONT );
-			TFT_setForeGround( UNIT1_COLOR );
-			TFT_setBackGround( BACKGROUND_COLOR );
-			TFT_setXPos( xpos );
-			TFT_setYPos( UNIT1_YPOS );
-			TFT_printf( szUnitPrefix );
-
-			TFT_setForeGround( BACKGROUND_COLOR );
-			TFT_fillRect( TFT_getXPos(), TFT_getYPos() - TFT_getFontHeight(), BUTTON_XPOS - 10, TFT_getYPos() + 10 );	// must be TOP/LEFT -> BOTTOM/RIGHT
-
-			if( dualmode )
-			{
-				if( scale == SCALE_FREQ )
-				{
-					*szUnitPrefix = 0;
-					*szUnit = '%'; szUnit[1] = 0;
-					err = ERRVAL_SUCCESS;
-				}
-				else if( DMM_isAC( scale ) )
-					err = DMM_GetScaleUnit( SCALE_FREQ, &dScaleFact, szUnitPrefix, szUnit, NULL );
-				else
-				{
-					*szUnitPrefix = 0;
-					*szUnit = 0;
-					err = ERRVAL_SUCCESS;
-				}
-
-				if( err == ERRVAL_SUCCESS )
-					strcat( szUnitPrefix, szUnit );
-
-				TFT_setForeGround( UNIT2_COLOR );
-				TFT_setBackGround( BACKGROUND_COLOR );
-				TFT_setXPos( UNIT2_XPOS );
-				TFT_setYPos( UNIT2_YPOS );
-				TFT_printf( "%s", szUnitPrefix );
-
-				TFT_setForeGround( BACKGROUND_COLOR );
-				TFT_fillRect( TFT_getXPos(), TFT_getYPos() - TFT_getFontHeight(), BUTTON_XPOS - 10, TFT_getYPos() + 10 );	// must be TOP/LEFT -> BOTTOM/RIGHT
-			}
-#if 0
-			if( dualmode == 2 )
-			{
-				err = DMM_GetScaleUnit( scale, &dScaleFact, szUnitPrefix, szUnit, NULL );
-				if( err == ERRVAL_SUCCESS )
-					strcat( szUnitPrefix, szUnit );
-
-				TFT_setForeGround( UNIT3_COLOR );
-				TFT_setBackGround( BACKGROUND_COLOR );
-				TFT_setXPos( UNIT3_XPOS );
-				TFT_setYPos( UNIT3_YPOS );
-				TFT_printf( szUnitPrefix );
-
-				TFT_setForeGround( BACKGROUND_COLOR );
-				TFT_fillRect( TFT_getXPos(), TFT_getYPos() - TFT_getFontHeight(), BUTTON_XPOS - 10, TFT_getYPos() + 10 );	// must be TOP/LEFT -> BOTTOM/RIGHT
-			}
-#endif
 			DMM_Trigger( channel );
 		}
 	}
@@ -851,15 +1216,15 @@ static void RangeCalib( uint8_t which, int state )
 			break;
 
 		case 1:
-			if(		 DMM_isFRES(idxScale) )	TFT_printf( "Apply resistance %s", dmmranges[idxScale] );
-			else if( DMM_isCURR(idxScale) )	TFT_printf( "Apply %s to I & LO inputs", dmmranges[idxScale] );
+			if(		 DMM_isFRES(idxScale) )	TFT_printf( "Apply resistance %s", DMM_GetDisplay( idxScale )->name );
+			else if( DMM_isCURR(idxScale) )	TFT_printf( "Apply %s to I & LO inputs", DMM_GetDisplay( idxScale )->name );
 			else if( DMM_isDIOD(idxScale) )	TFT_printf( "Apply 3.0V to HI & LO inputs" );
-			else							TFT_printf( "Apply %s to HI & LO inputs", dmmranges[idxScale] );
+			else							TFT_printf( "Apply %s to HI & LO inputs", DMM_GetDisplay( idxScale )->name );
 			break;
 
 		case 2:
-			if(		 DMM_isCURR(idxScale) )	TFT_printf( "Apply -%s to I & LO inputs", dmmranges[idxScale] );
-			else							TFT_printf( "Apply -%s to HI & LO inputs", dmmranges[idxScale] );
+			if(		 DMM_isCURR(idxScale) )	TFT_printf( "Apply -%s to I & LO inputs", DMM_GetDisplay( idxScale )->name );
+			else							TFT_printf( "Apply -%s to HI & LO inputs", DMM_GetDisplay( idxScale )->name );
 			break;
 		}
 
@@ -938,98 +1303,354 @@ static void RangeCalib( uint8_t which, int state )
 }
 #endif
 
-void Application( void )
+static void DrawTrend( uint8_t arg )
 {
-	uint8_t key, last_key = 0;
-	uint16_t repeat_timeout = 0;
+	if( !hold )
+		TREND_AddSample( DMM_GetScale( 1 ), dMeasuredVal[0] );
+}
 
-	KBD_Init();
-	DMM_Init();
+static void SetTrend( int mode )	// -1: toggle
+{
+	uint8_t on = ( mode < 0 ) ? !TREND_isActive() : mode;
 
-	TFT_setForeGround( BACKGROUND_COLOR );
-	TFT_fillRect( 0, 0, TFT_WIDTH-1, TFT_HEIGHT-1 );		// Clear screen
+	if( on == TREND_isActive() )
+		return;
 
-	*(uint16_t*)&APP_flags = HAL_RTCEx_BKUPRead( &hrtc, RTC_BKP_DR1 );	// read NVM flags
+	if( on )
+	{
+		TREND_Start();
+		ui_hidden = TREND_HIDES;		// these would scroll with the plot
+		ui_dirty &= ~( 1UL << W_TREND );
+	}
+	else
+		RedrawScreen();
+}
 
-	SetScale( 1, SCALE_SAVED );
-	SetAuto( 1 );
-	SetHold( 0 );
-	SetRelMode( 0, 0 );
+static const WIDGET widgets[W_COUNT] = {
+	[W_HEADER]	= { DrawHeader,			0 },
+	[W_TIME]	= { DrawTime,			0 },
+	[W_BUTTON1]	= { DrawButton,			0 },
+	[W_BUTTON2]	= { DrawButton,			1 },
+	[W_BUTTON3]	= { DrawButton,			2 },
+	[W_BUTTON4]	= { DrawButton,			3 },
+	[W_BUTTON5]	= { DrawButton,			4 },
+	[W_FOOTER]	= { DrawFooterWidget,	0 },
+	[W_UNITS]	= { DrawUnits,			0 },
+	[W_VALUE]	= { DrawValue,			0 },
+	[W_BAR]		= { DrawBar,			0 },
+	[W_HOLD]	= { DrawIndicator,		W_HOLD },
+	[W_AUTO]	= { DrawIndicator,		W_AUTO },
+	[W_REL]		= { DrawIndicator,		W_REL },
+	[W_TREND]	= { DrawTrend,			0 },
+};
 
-	DMM_SetAveraging( 1, 1 );
-	DMM_SetUseCalib( 1, 1 );
+static void StartFrame( void )
+{
+	ui_frame = ui_dirty & ~ui_hidden;
+	ui_dirty &= ~ui_frame;
+	frameTime = 0;
+	frameWidgets = 0;
+}
+
+static void EndFrame( void )
+{
+	uint32_t time = frameTime / ( SystemCoreClock / 1000000 );
+
+	ui_stats.frames++;
+	ui_stats.widgets += frameWidgets;
+	ui_stats.last = time;
+	if( time > ui_stats.max )
+		ui_stats.max = time;
+	if( time > ui_stats.budget )
+		ui_stats.overBudget++;
+}
+
+static void Compose( void )		// frame scheduler, called by the UI task
+{
+	uint32_t now = HAL_GetTick(), start;
+	uint8_t w;
+
+	if( (int32_t)( now - frameDue ) >= 0 )
+	{
+		if( ui_frame )						// previous frame still in flight: skip this one
+			ui_stats.dropped++;
+		else if( ui_dirty & ~ui_hidden )
+			StartFrame();
+
+		frameDue += 1000 / frameRate;
+		if( (int32_t)( now - frameDue ) >= 0 )	// fell behind, don't try to catch up
+			frameDue = now + 1000 / frameRate;
+	}
+
+	ui_dirty |= ui_frame & ui_hidden;		// widgets hidden meanwhile wait until shown again
+	ui_frame &= ~ui_hidden;
 
-	for(;;)
+	if( !ui_frame )
+		return;
+
+	for( w = 0; !( ui_frame & ( 1UL << w ) ); ++w )		// next widget in z-order
+		;
+
+	ui_frame &= ~( 1UL << w );
+	start = DWT->CYCCNT;
+	widgets[w].draw( widgets[w].arg );
+	frameTime += DWT->CYCCNT - start;
+	++frameWidgets;
+
+	ui_frame |= ui_dirty & ~ui_hidden & ~( ( 2UL << w ) - 1 );	// invalidated by this widget, and on top of it
+	ui_dirty &= ~ui_frame;
+
+	if( !ui_frame )
+		EndFrame();
+}
+
+static void PaintRemote( void )		// static banner, the only thing on screen in remote mode
+{
+	TFT_setFont( ERROR_FONT );
+	TFT_setFontSize( ERROR_FONT_SIZE );
+	TFT_setForeGround( INDICATOR_ON_COLOR );
+	TFT_setBackGround( BACKGROUND_COLOR );
+	TFT_setXPos( ( TFT_WIDTH - TFT_getStrWidth( "REMOTE" ) ) / 2 );
+	TFT_setYPos( ( TFT_HEIGHT + TFT_getFontHeight() ) / 2 );
+	TFT_puts( "REMOTE" );
+	TFT_setFontSize( 1 );
+}
+
+void RedrawScreen( void )		// clear screen, repaint everything with the next frame
+{
+	TREND_Stop();
+	ui_hidden = 1UL << W_TREND;
+
+	TFT_setForeGround( BACKGROUND_COLOR );
+	TFT_fillRect( 0, 0, TFT_WIDTH-1, TFT_HEIGHT-1 );
+
+	InvalidateValues();
+	ui_frame = 0;
+
+	if( remote )						// nothing but the banner, all widgets stay dirty until local
 	{
-		Do_SCPI();
+		PaintRemote();
+		ui_hidden = ( 1UL << W_COUNT ) - 1;
+		ui_dirty = ui_hidden & ~( 1UL << W_TREND );
+		return;
+	}
+
+	ui_dirty = ( ( 1UL << W_COUNT ) - 1 ) & ~( 1UL << W_TREND );
+	if( !curMenu )						// no menu yet
+		ui_dirty &= ~( ( 1UL << W_HEADER ) | ( 0x1FUL << W_BUTTON1 ) );
+}
+
+/*
+ * Remote mode: the screen is frozen to a static banner and no widget is rendered,
+ * so every main loop pass goes to acquisition and SCPI. Entering costs one screen clear,
+ * leaving repaints everything from the current state with the next frame.
+ */
+void SetRemote( uint8_t on )
+{
+	on = !!on;
+	if( on == remote )
+		return;
+
+	remote = on;
+	RedrawScreen();
+	filterSum = 0;						// not accumulated while remote
+	filterCount = 0;
+}
+
+uint8_t GetRemote( void )
+{
+	return remote;
+}
+
+const FRAME_STATS *GetFrameStats( void )
+{
+	return &ui_stats;
+}
+
+void ResetFrameStats( void )
+{
+	memset( &ui_stats, 0, sizeof(ui_stats) );
+	ui_stats.budget = 1000000 / frameRate;
+}
+
+void SetFrameRate( int hz )		// clamped to FRAME_RATE_MIN..MAX
+{
+	if( hz < FRAME_RATE_MIN ) hz = FRAME_RATE_MIN;
+	if( hz > FRAME_RATE_MAX ) hz = FRAME_RATE_MAX;
+
+	frameRate = hz;
+	ResetFrameStats();
+}
+
+uint8_t GetFrameRate( void )
+{
+	return frameRate;
+}
+
+void SetDisplayFilter( uint8_t on )
+{
+	displayFilter = on;
+	filterSum = 0;
+	filterCount = 0;
+}
+
+uint8_t GetDisplayFilter( void )
+{
+	return displayFilter;
+}
+
+uint32_t GetReadings( void )
+{
+	return readings;
+}
 
-		DrawTime( 0 );
+static void AcqTask( void )		// HY3131 pickup
+{
+	if( CALIB_Busy() )				// calibration point measurement owns the HY3131
+	{
+		if( CALIB_Poll( NULL ) != ERRVAL_CMD_BUSY )
+			SCHED_Signal( TASK_SCPI );
+		return;
+	}
 
-		switch( DMM_Measure( 1 ) )
+	switch( DMM_Measure( 1 ) )
+	{
+	case ERRVAL_SUCCESS:
+		++readings;
+		TRIG_Reading( dMeasuredVal[0] );
+		SCPI_Stream( dMeasuredVal[0] );
+		if( !hold && !remote )
 		{
-		case ERRVAL_SUCCESS:
-			DrawValue();
-			// no break
-		case ERRVAL_CMD_NO_TRIGGER:
-//		case ERRVAL_CALIB_NANDOUBLE:
-			DMM_Trigger( 1 );
-			break;
+			filterSum += dMeasuredVal[0];
+			++filterCount;
 		}
+		Invalidate( W_VALUE );
+		Invalidate( W_TREND );
+		// no break
+	case ERRVAL_CMD_NO_TRIGGER:
+//	case ERRVAL_CALIB_NANDOUBLE:
+		DMM_Trigger( 1 );
+		break;
+	}
+}
 
-		key = KBD_Read();
+static void KeysTask( void )		// signalled by the key scanner
+{
+	uint8_t event;
 
-		if( key == last_key && key && !hold )
+	while( ( event = KBD_GetEvent() ) != 0 )
+	{
+		uint8_t key = KEY_CODE( event );
+		int curMode;
+
+		if( remote )					// front panel locked, EXIT is the LOCAL key
 		{
-			if( ++repeat_timeout == START_REPEAT )
-				last_key = 0;
+			if( event == ( KEY_PRESS | KEY_EXIT ) )
+				SetRemote( 0 );
+			continue;
 		}
 
-		if( key != last_key )
+		if( KEY_TYPE( event ) == KEY_RELEASE )
+			continue;
+
+		if( KEY_TYPE( event ) == KEY_REPEAT && ( hold || ( key != KEY_UP && key != KEY_DOWN ) ) )
+			continue;					// only range stepping auto-repeats
+
+		curMode = DMM_GetMode( DMM_GetScale( 1 ) );
+
+		switch( key )
 		{
-			int curMode = DMM_GetMode( DMM_GetScale( 1 ) );
+		// below display
+		case KEY_VOLT:	SetScale( 1, ( curMode == DmmDCVoltage || curMode == DmmACVoltage ) ? SCALE_ALT : SCALE_DC_50V ); break;
+		case KEY_AMP:	SetScale( 1, ( curMode == DmmDCCurrent || curMode == DmmACCurrent ) ? SCALE_ALT : SCALE_DC_500mA ); break;
+		case KEY_OHM:	SetScale( 1, ( curMode == DmmResistance || curMode == DmmResistance4W || curMode == DmmDiode || curMode == DmmContinuity ) ? SCALE_ALT : SCALE_500_Ohm ); break;
+		case KEY_FREQ:	SetScale( 1, SCALE_FREQ ); break;
+		case KEY_CAP:	SetScale( 1, SCALE_50_nF ); break;
+		case KEY_TEMP:	SetScale( 1, ( curMode == DmmTemperature ) ? SCALE_ALT : SCALE_TEMP ); break;
 
-			repeat_timeout = 0;
+		// soft keys right
+		case KEY_F1:	MenuFunction( 1 ); break;
+		case KEY_F2:	MenuFunction( 2 ); break;
+		case KEY_F3:	MenuFunction( 3 ); break;
+		case KEY_F4:	MenuFunction( 4 ); break;
+		case KEY_F5:	MenuFunction( 5 ); break;
 
-			switch( key )
-			{
-			// below display
-			case KEY_VOLT:	SetScale( 1, ( curMode == DmmDCVoltage || curMode == DmmACVoltage ) ? SCALE_ALT : SCALE_DC_50V ); break;
-			case KEY_AMP:	SetScale( 1, ( curMode == DmmDCCurrent || curMode == DmmACCurrent ) ? SCALE_ALT : SCALE_DC_500mA ); break;
-			case KEY_OHM:	SetScale( 1, ( curMode == DmmResistance || curMode == DmmResistance4W || curMode == DmmDiode || curMode == DmmContinuity ) ? SCALE_ALT : SCALE_500_Ohm ); break;
-			case KEY_FREQ:	SetScale( 1, SCALE_FREQ ); break;
-			case KEY_CAP:	SetScale( 1, SCALE_50_nF ); break;
-			case KEY_TEMP:	SetScale( 1, ( curMode == DmmTemperature ) ? SCALE_ALT : SCALE_TEMP ); break;
-
-			// soft keys right
-			case KEY_F1:	MenuFunction( 1 ); break;
-			case KEY_F2:	MenuFunction( 2 ); break;
-			case KEY_F3:	MenuFunction( 3 ); break;
-			case KEY_F4:	MenuFunction( 4 ); break;
-			case KEY_F5:	MenuFunction( 5 ); break;
-
-			// Run/Stop
-			case KEY_RUN:	SetHold( -1 ); break;
-
-			case KEY_RANGE:	SetScale( 1, SCALE_AUTO ); break;
-			case KEY_UP:	SetScale( 1, SCALE_UP ); break;
-			case KEY_DOWN:	SetScale( 1, SCALE_DOWN ); break;
-
-			case KEY_UTIL:	DoMenu( DMM_CAL_ZERO ); break;
-
-			default:		break;
+		// Run/Stop
+		case KEY_RUN:	SetHold( -1 ); break;
+
+		case KEY_RANGE:	SetScale( 1, SCALE_AUTO ); break;
+		case KEY_UP:	SetScale( 1, SCALE_UP ); break;
+		case KEY_DOWN:	SetScale( 1, SCALE_DOWN ); break;
+
+		case KEY_UTIL:	DoMenu( DMM_CAL_ZERO ); break;
+
+		case KEY_REC:	SetTrend( -1 ); break;
+
+		default:		break;
 #if 0
-			case KEY_LEFT:	break;
-			case KEY_RIGHT:	break;
-			case KEY_DUAL:	break;
-			case KEY_EXIT:	break;
-			case KEY_MATH:	break;
-			case KEY_SAVE:	break;
-			case KEY_REC:	break;
-			case KEY_PORT:	break;
+		case KEY_LEFT:	break;
+		case KEY_RIGHT:	break;
+		case KEY_DUAL:	break;
+		case KEY_EXIT:	break;
+		case KEY_MATH:	break;
+		case KEY_SAVE:	break;
+		case KEY_PORT:	break;
 #endif
-			}
 		}
-		last_key = key;
 	}
 }
 
+static void UiTask( void )
+{
+	if( remote )
+		return;
+
+	CheckTime();
+	CheckBar();
+	CheckFooter();
+	Compose();
+
+	if( ui_frame )					// finish the frame in flight as soon as nothing else is due
+		SCHED_Signal( TASK_UI );
+}
+
+static const TASK appTasks[TASK_COUNT] = {		// name, function, period [ms], deadline [ms]
+	[TASK_ACQ]	= { "ACQ",	AcqTask,	1,	2 },
+	[TASK_SCPI]	= { "SCPI",	Do_SCPI,	10,	10 },
+	[TASK_KEYS]	= { "KEYS",	KeysTask,	0,	20 },
+	[TASK_UI]	= { "UI",	UiTask,		5,	50 },
+};
+
+void Application( void )
+{
+	KBD_Init();
+
+#ifdef TFT_BENCHMARK
+	TFT_Benchmark();
+	while( !KBD_Read() );
+	KBD_Flush();
+#endif
+
+	DMM_Init();
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;		// cycle counter for frame timing
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	RedrawScreen();
+
+	*(uint16_t*)&APP_flags = HAL_RTCEx_BKUPRead( &hrtc, RTC_BKP_DR1 );	// read NVM flags
+
+	SetScale( 1, SCALE_SAVED );
+	SetAuto( 1 );
+	SetHold( 0 );
+	SetRelMode( 0, 0 );
+
+	DMM_SetAveraging( 1, 1 );
+	DMM_SetUseCalib( 1, 1 );
+
+	SCPI_Init();
+	SCHED_Init( appTasks );
+	SCHED_Run();
+}
+
@@ -319,29 +319,12 @@ static double CALIB_ComputeAdd( int idxScale )
 	return fResult;
 }
 
-static uint8_t CALIB_Measure( double *val )
-{
-	int bResult = ERRVAL_SUCCESS;
-
-	DMM_SetUseCalib( 1, 0 );
-	DMM_SetAveraging( 1, MEASURE_CNT_AVG ); // compute average value
-
-	uint16_t timeout = DMM_VALIDDATA_CNTTIMEOUT;
-	do
-	{
-		DMM_Trigger( 1 );
-		while( ( bResult = DMM_Measure( 1 ) ) == ERRVAL_CMD_BUSY )
-			;
-	} while( ( bResult != ERRVAL_SUCCESS || DMM_isNAN( dMeasuredVal[0] ) ) && --timeout );
-
-	DMM_SetUseCalib( 1, 1 );
-	DMM_SetAveraging( 1, 1 );
-
-	if( bResult == ERRVAL_SUCCESS )
-		*val = dMeasuredVal[0];
-
-	return bResult;
-}
+static struct {
+	uint8_t point;			// calibration point being measured, CALIB_IDLE if none
+	int idxScale;
+	double dRefVal;
+	uint16_t timeout;		// valid data re-tries left
+} pending = { .point = CALIB_IDLE };
 
 /***	CALIB_CheckCompleteCalib
  **
@@ -388,40 +371,111 @@ static uint8_t CALIB_CheckCompleteCalib( void )
 	return ERRVAL_SUCCESS;
 }
 
-/***	CALIB_CalibOnZero
+/***	CALIB_Start
  **
  **	Parameters:
- **		double *pMeasuredVal            - Pointer to a double variable that will store the measured value
+ **		uint8_t point             - CALIB_ZERO, CALIB_POSITIVE or CALIB_NEGATIVE
+ **		double dRefVal            - The reference value of the point (ignored for CALIB_ZERO)
  **
  **	Return Value:
  **		uint8_t
- **          ERRVAL_SUCCESS                  0       // success
+ **          ERRVAL_CMD_BUSY                 0xF1    // measurement started, call CALIB_Poll() until done
  **          ERRVAL_DMM_IDXCONFIG            0xFC    // wrong scale index
- **          ERRVAL_DMM_VALIDDATATIMEOUT     0xFA    // valid data DMM timeout
+ **          ERRVAL_CMD_WRONGPARAMS          0xF9    // bad calibration point
  **
  **	Description:
- **		This function implements the calibration on zero procedure, for the currently selected scale.
- **      The function calls the CALIB_MeasureForCalibZeroVal local function in order to perform the measurement and provide the measured value.
- **      When success, the function calls local function CALIB_CheckCompleteCalib, to check if the calibration process is complete.
- **      If there is no valid current configuration selected, the function returns ERRVAL_DMM_IDXCONFIG and the measured value is set to NAN.
- **      If a valid measurement cannot be performed, the function returns ERRVAL_DMM_VALIDDATATIMEOUT and the measured value is set to NAN.
+ **		This function starts the measurement of one calibration point for the currently selected scale, without waiting for it:
+ **      channel 1 is switched to uncalibrated readings, averaged over MEASURE_CNT_AVG passes, and triggered.
+ **      From then on, whoever drives the acquisition must call CALIB_Poll() instead of DMM_Measure(), until it no longer returns ERRVAL_CMD_BUSY.
  **
  */
-uint8_t CALIB_CalibOnZero( double *pMeasuredVal )
+uint8_t CALIB_Start( uint8_t point, double dRefVal )
 {
-	double dVal = NAN;
 	int idxScale = DMM_GetScale( 1 );
 	uint8_t bResult = DMM_isScale( idxScale );
-	if( bResult == ERRVAL_SUCCESS )
-		bResult = CALIB_Measure( &dVal );
-
 	if( bResult != ERRVAL_SUCCESS )
-		dVal = NAN;
+		return bResult;
+
+	if( point >= CALIB_IDLE )
+		return ERRVAL_CMD_WRONGPARAMS;
+
+	pending.point = point;
+	pending.idxScale = idxScale;
+	pending.dRefVal = dRefVal;
+	pending.timeout = DMM_VALIDDATA_CNTTIMEOUT;
+
+	DMM_SetUseCalib( 1, 0 );
+	DMM_SetAveraging( 1, MEASURE_CNT_AVG ); // compute average value
+	DMM_Trigger( 1 );
+
+	return ERRVAL_CMD_BUSY;
+}
+
+/***	CALIB_Poll
+ **
+ **	Parameters:
+ **		double *pMeasuredVal            - Pointer to a double variable that will store the measured value, may be NULL
+ **
+ **	Return Value:
+ **		uint8_t
+ **          ERRVAL_SUCCESS                  0       // success, the point is stored
+ **          ERRVAL_CMD_BUSY                 0xF1    // measurement in progress
+ **          ERRVAL_CMD_NO_TRIGGER           0xF3    // no calibration point started
+ **          other                                   // the error of the last measurement attempt, the measured value is set to NAN
+ **
+ **	Description:
+ **		This function takes the readings of the calibration point started by CALIB_Start(), it never waits.
+ **      A failed or NAN reading is re-triggered up to DMM_VALIDDATA_CNTTIMEOUT times. When done, normal readings are restored,
+ **      the measured value (NAN on error) and the reference value are stored in partCalibData, and on success
+ **      CALIB_CheckCompleteCalib is called, to check if the calibration process is complete.
+ **
+ */
+uint8_t CALIB_Poll( double *pMeasuredVal )
+{
+	PARTCALIB *part;
+	double dVal = NAN;
+	uint8_t bResult;
+
+	if( pending.point == CALIB_IDLE )
+		return ERRVAL_CMD_NO_TRIGGER;
+
+	bResult = DMM_Measure( 1 );
+	if( bResult == ERRVAL_CMD_BUSY )
+		return bResult;
+
+	if( ( bResult != ERRVAL_SUCCESS || DMM_isNAN( dMeasuredVal[0] ) ) && --pending.timeout )
+	{
+		DMM_Trigger( 1 );		// try again
+		return ERRVAL_CMD_BUSY;
+	}
+
+	DMM_SetUseCalib( 1, 1 );
+	DMM_SetAveraging( 1, 1 );
+
+	if( bResult == ERRVAL_SUCCESS )
+		dVal = dMeasuredVal[0];
 
 	if( pMeasuredVal )
 		*pMeasuredVal = dVal;
 
-	partCalib.DmmPartCalib[ idxScale ].Calib_Ms_Zero = dVal;	// store the measured value
+	part = &partCalib.DmmPartCalib[ pending.idxScale ];
+	switch( pending.point )
+	{
+	case CALIB_ZERO:
+		part->Calib_Ms_Zero = dVal;				// store the measured value
+		break;
+
+	case CALIB_POSITIVE:
+		part->Calib_Ref_ValP = pending.dRefVal;	// store the reference value
+		part->Calib_Ms_ValP = dVal;				// store the measured value or NAN on error
+		break;
+
+	case CALIB_NEGATIVE:
+		part->Calib_Ref_ValN = pending.dRefVal;
+		part->Calib_Ms_ValN = dVal;
+		break;
+	}
+	pending.point = CALIB_IDLE;
 
 	if( bResult == ERRVAL_SUCCESS )
 		CALIB_CheckCompleteCalib();		// check if the calibration data is complete
@@ -429,6 +483,53 @@ uint8_t CALIB_CalibOnZero( double *pMeasuredVal )
 	return bResult;
 }
 
+uint8_t CALIB_Busy( void )
+{
+	return pending.point != CALIB_IDLE;
+}
+
+static uint8_t CALIB_CalibOn( uint8_t point, double dRefVal, double *pMeasuredVal )		// blocking
+{
+	uint8_t bResult = CALIB_Start( point, dRefVal );
+
+	if( bResult != ERRVAL_CMD_BUSY )
+	{
+		if( pMeasuredVal )
+			*pMeasuredVal = NAN;
+		return bResult;
+	}
+
+	while( ( bResult = CALIB_Poll( pMeasuredVal ) ) == ERRVAL_CMD_BUSY )
+		;
+
+	return bResult;
+}
+
+
+/***	CALIB_CalibOnZero
+ **
+ **	Parameters:
+ **		double *pMeasuredVal            - Pointer to a double variable that will store the measured value
+ **
+ **	Return Value:
+ **		uint8_t
+ **          ERRVAL_SUCCESS                  0       // success
+ **          ERRVAL_DMM_IDXCONFIG            0xFC    // wrong scale index
+ **          ERRVAL_DMM_VALIDDATATIMEOUT     0xFA    // valid data DMM timeout
+ **
+ **	Description:
+ **		This function implements the calibration on zero procedure, for the currently selected scale.
+ **      The function waits for CALIB_Start() and CALIB_Poll() in order to perform the measurement and provide the measured value.
+ **      When success, the function calls local function CALIB_CheckCompleteCalib, to check if the calibration process is complete.
+ **      If there is no valid current configuration selected, the function returns ERRVAL_DMM_IDXCONFIG and the measured value is set to NAN.
+ **      If a valid measurement cannot be performed, the function returns ERRVAL_DMM_VALIDDATATIMEOUT and the measured value is set to NAN.
+ **
+ */
+uint8_t CALIB_CalibOnZero( double *pMeasuredVal )
+{
+	return CALIB_CalibOn( CALIB_ZERO, 0.0, pMeasuredVal );
+}
+
 /***	CALIB_CalibOnPositive
  **
  **	Parameters:
@@ -444,7 +545,7 @@ uint8_t CALIB_CalibOnZero( double *pMeasuredVal )
  **
  **	Description:
  **      This function implements the calibration on positive value procedure, for the currently selected scale.
- **      The function calls CALIB_MeasureForCalibPositiveVal in order to perform the measurement and provide the measured value.
+ **      The function waits for CALIB_Start() and CALIB_Poll() in order to perform the measurement and provide the measured value.
  **      If Calib_Ms_ValP is not valid the function returns ERRVAL_CALIB_MISSINGMEASUREMENT.
  **      When success, the reference value is stored in the Calib_Ref_ValP field of partCalibData.
  **      When success, the function calls local function CALIB_CheckCompleteCalib, to check if the calibration process is complete.
@@ -454,25 +555,7 @@ uint8_t CALIB_CalibOnZero( double *pMeasuredVal )
  */
 uint8_t CALIB_CalibOnPositive( double dRefVal, double *pMeasuredVal )
 {
-	double dVal = NAN;
-	int idxScale = DMM_GetScale( 1 );
-	uint8_t bResult = DMM_isScale( idxScale );
-	if( bResult == ERRVAL_SUCCESS )
-		bResult = CALIB_Measure( &dVal );
-
-	if( bResult != ERRVAL_SUCCESS )
-		dVal = NAN;
-
-	if( pMeasuredVal )
-		*pMeasuredVal = dVal;
-
-	partCalib.DmmPartCalib[ idxScale ].Calib_Ref_ValP = dRefVal;	// store the reference value
-	partCalib.DmmPartCalib[ idxScale ].Calib_Ms_ValP = dVal;		// store the measured value or NAN on error
-
-	if( bResult == ERRVAL_SUCCESS )
-		CALIB_CheckCompleteCalib();		// check if the calibration data is complete
-
-	return bResult;
+	return CALIB_CalibOn( CALIB_POSITIVE, dRefVal, pMeasuredVal );
 }
 
 /***	CALIB_CalibOnNegative
@@ -490,7 +573,7 @@ uint8_t CALIB_CalibOnPositive( double dRefVal, double *pMeasuredVal )
  **
  **	Description:
  **		This function implements the calibration on negative value procedure, for the current selected scale.
- **      The function calls CALIB_MeasureForCalibNegativeVal in order to perform the measurement and provide the measured value.
+ **      The function waits for CALIB_Start() and CALIB_Poll() in order to perform the measurement and provide the measured value.
  **      If Calib_Ms_ValP is not valid the function returns ERRVAL_CALIB_MISSINGMEASUREMENT.
  **      If there is no valid current configuration selected, the function returns ERRVAL_DMM_IDXCONFIG and the measured value is set to NAN.
  **      If a valid measurement cannot be performed, the function returns ERRVAL_DMM_VALIDDATATIMEOUT and the measured value is set to NAN.
@@ -500,25 +583,7 @@ uint8_t CALIB_CalibOnPositive( double dRefVal, double *pMeasuredVal )
  */
 uint8_t CALIB_CalibOnNegative( double dRefVal, double *pMeasuredVal )
 {
-	double dVal = NAN;
-	int idxScale = DMM_GetScale( 1 );
-	uint8_t bResult = DMM_isScale( idxScale );
-	if( bResult == ERRVAL_SUCCESS )
-		bResult = CALIB_Measure( &dVal );
-
-	if( bResult != ERRVAL_SUCCESS )
-		dVal = NAN;
-
-	if( pMeasuredVal )
-		*pMeasuredVal = dVal;
-
-	partCalib.DmmPartCalib[ idxScale ].Calib_Ref_ValN = dRefVal;	// store the reference value
-	partCalib.DmmPartCalib[ idxScale ].Calib_Ms_ValN = dVal;		// store the measured value or NAN on error
-
-	if( bResult == ERRVAL_SUCCESS )
-		CALIB_CheckCompleteCalib();	// check if the calibration data is complete
-
-	return bResult;
+	return CALIB_CalibOn( CALIB_NEGATIVE, dRefVal, pMeasuredVal );
 }
 
 /* *****************************************************************************
@@ -23,71 +23,71 @@
 #define CS_RLY			1
 
 const DMMCFG dmmcfg[] = {
-// Measure type,	FSR,	fmt,		sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
-{ DmmDCVoltage,		5e-2,	"%+7.3f",	0x01,	{0x04, 0xC0,0x21,0x14,0x8B,0x35,0x11,0x08,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x08, 0x81,0x80,0xC7,0x3C,0xA8}, 125e-3 / 1.8 / 0x800000 },	// 50 mV DC
-{ DmmDCVoltage,		5e-1,	"%+7.2f",	0x01,	{0x04, 0xC0,0x21,0x14,0x8B,0x85,0x11,0x08,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x08, 0x81,0x80,0xC7,0x33,0xA8}, 125e-2 / 1.8 / 0x800000 },	// 500 mV DC
-{ DmmDCVoltage,		5e0,	"%+7.4f",	0x21,	{0x04, 0xC0,0x21,0x14,0x8B,0x01,0x11,0x08,0x15,0x31,0xF8, 0x20,0x00,0x00,0x90,0x28, 0xA0,0x80,0xC7,0x33,0xA8}, 125e-1 / 1.8 / 0x800000 },	// 5 V DC
-{ DmmDCVoltage,		5e1,	"%+7.3f",	0x21,	{0x04, 0xC0,0x21,0x14,0x8B,0x01,0x11,0x08,0x15,0x31,0xF8, 0x20,0x00,0x00,0x09,0x28, 0xA0,0x80,0xC7,0x33,0xA8}, 125e0  / 1.8 / 0x800000 },	// 50 V DC
-{ DmmDCVoltage,		5e2,	"%+7.2f",	0x21,	{0x04, 0xC0,0x21,0x14,0x8B,0x01,0x11,0x08,0x15,0x31,0xF8, 0x20,0x00,0x90,0x00,0x28, 0xA0,0x80,0xC7,0x33,0xA8}, 125e1  / 1.8 / 0x800000 },	// 500 V DC
-{ DmmDCVoltage,		1e3,	"%+7.4f",	0x21,	{0x04, 0xC0,0x21,0x14,0x8B,0x09,0x01,0x08,0x15,0x31,0xF8, 0x20,0x00,0x90,0x00,0x28, 0xA0,0x80,0xC7,0x33,0xA8}, 125e1  / 0.9 / 0x800000 },	// 1kV DC
-
-// Measure type,	FSR,	fmt,		sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
-{ DmmACVoltage,		5e-1,	"%7.2f",	0x01,	{0x11, 0x10,0xDD,0x00,0x00,0x45,0x00,0x88,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x08, 0x91,0x80,0xC7,0x3C,0xA0}, 1e-5 },						// 500 mV AC
-{ DmmACVoltage,		5e0,	"%7.4f",	0x21,	{0x11, 0x10,0xDD,0x00,0x00,0x4D,0x00,0x88,0x15,0x31,0xF8, 0x22,0x00,0x00,0xD0,0x88, 0xA0,0xE9,0xC7,0x38,0x20}, 1e-4 },						// 5 V AC
-{ DmmACVoltage,		5e1,	"%7.3f",	0x21,	{0x11, 0x10,0xDD,0x00,0x00,0x4D,0x00,0x88,0x15,0x31,0xF8, 0x22,0x00,0x00,0x09,0x28, 0xA0,0xFF,0xC7,0x38,0x20}, 1e-3 },						// 50 V AC
-{ DmmACVoltage,		5e2,	"%7.2f",	0x21,	{0x11, 0x10,0xDD,0x00,0x00,0x4D,0x00,0x88,0x15,0x31,0xF8, 0x22,0x00,0x90,0x00,0x28, 0xA0,0x80,0xC7,0x38,0x20}, 1e-2 },						// 500 V AC
-{ DmmACVoltage,		7.5e2,	"%7.2f",	0x21,	{0x11, 0x10,0xDD,0x00,0x00,0x4D,0x00,0x88,0x15,0x31,0xF8, 0x22,0x00,0x90,0x00,0x28, 0xA0,0x80,0xC7,0x38,0x20}, 1e-2 },						// 750 V AC
-
-// Measure type,	FSR,	fmt,		sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
-{ DmmDCCurrent,		5e-4,	"%+7.2f",	0x20,	{0x04, 0xC0,0x21,0x14,0x8B,0x35,0x11,0x08,0x15,0x11,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0xAC}, 125e-5 / 1.8 / 0x800000 },	// 500uA DC
-{ DmmDCCurrent,		5e-3,	"%+7.4f",	0x20,	{0x04, 0xC0,0x21,0x14,0x8B,0x95,0x11,0x08,0x15,0x11,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x33,0xAC}, 125e-4 / 1.8 / 0x800000 },	// 5mA DC
-{ DmmDCCurrent,		5e-2,	"%+7.3f",	0x22,	{0x04, 0xC0,0x21,0x14,0x8B,0x35,0x11,0x08,0x15,0x11,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0xAC}, 125e-3 / 1.8 / 0x800000 },	// 50mA DC
-{ DmmDCCurrent,		5e-1,	"%+7.2f",	0x22,	{0x04, 0xC0,0x21,0x14,0x8B,0x95,0x11,0x08,0x15,0x11,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x33,0xAC}, 125e-2 / 1.8 / 0x800000 },	// 500mA DC
-{ DmmDCCurrent,		5e0,	"%+7.4f",	0x29,	{0x04, 0xC0,0x21,0x14,0x8B,0x35,0x11,0x08,0x15,0x11,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0xAC}, 125e-1 / 1.8 / 0x800000 },	// 5 A DC
-{ DmmDCCurrent,		10e0,	"%+7.3f",	0x29,	{0x04, 0xC0,0x21,0x14,0x8B,0x35,0x01,0x08,0x15,0x11,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0xAC}, 125e-1 / 0.9 / 0x800000 },	// 10 A DC
-
-// Measure type,	FSR,	fmt,		sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
-{ DmmACCurrent,		5e-4,	"%7.2f",	0x20,	{0x11, 0x10,0xDD,0x12,0x00,0x45,0x01,0x88,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0x20}, 1e-8 / 1.08 },				// 500 uA AC
-{ DmmACCurrent,		5e-3,	"%7.4f",	0x20,	{0x11, 0x10,0xDD,0x12,0x00,0x45,0x00,0x88,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0xA0}, 1e-7 / 2.16 },				// 5 mA AC
-{ DmmACCurrent,		5e-2,	"%7.3f",	0x22,	{0x11, 0x10,0xDD,0x12,0x00,0x45,0x01,0x88,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0x20}, 1e-6 / 1.08 },				// 50 mA AC
-{ DmmACCurrent,		5e-1,	"%7.2f",	0x22,	{0x11, 0x10,0xDD,0x12,0x00,0x45,0x00,0x88,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0xA0}, 1e-5 / 2.16 },				// 500 mA AC
-{ DmmACCurrent,		5e0,	"%7.4f",	0x29,	{0x11, 0x10,0xDD,0x12,0x00,0x45,0x01,0x88,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0x20}, 1e-4 / 1.08 },				// 5 A AC
-{ DmmACCurrent,		10e0,	"%7.3f",	0x29,	{0x11, 0x10,0xDD,0x12,0x00,0x45,0x00,0x88,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0xA0}, 1e-4 / 2.16 },				// 10 A AC
-
-// Measure type,	FSR,	fmt,		sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
-{ DmmResistance,	5e1,	"%7.3f",	0x05,	{0x04, 0x60,0x62,0x13,0x83,0x85,0x01,0x08,0x15,0x00,0xF8, 0x00,0x40,0x06,0x00,0x00, 0x94,0x80,0xD2,0x3F,0xAC}, 1e3 / 0.9 / 0x800000 },		// 50 Ohm
-{ DmmResistance,	5e2,	"%7.2f",	0x05,	{0x04, 0xC0,0x21,0x14,0x83,0x85,0x01,0x08,0x15,0x00,0xF8, 0x00,0x00,0x06,0x00,0x00, 0x94,0x80,0xD2,0x3F,0xAC}, 1e3 / 0.9 / 0x800000 },		// 500 Ohm
-{ DmmResistance,	5e3,	"%7.4f",	0x05,	{0x04, 0xC0,0x21,0x14,0x83,0x85,0x01,0x08,0x15,0x00,0xF8, 0x00,0x00,0x60,0x00,0x00, 0x94,0x80,0xD3,0x3F,0xAC}, 1e4 / 0.9 / 0x800000 },		// 5 kOhm
-{ DmmResistance,	5e4,	"%7.3f",	0x05,	{0x04, 0xC0,0x21,0x14,0x83,0x85,0x01,0x08,0x15,0x00,0xF8, 0x00,0x00,0x00,0x06,0x00, 0x94,0x80,0xD3,0x3F,0xAC}, 1e5 / 0.9 / 0x800000 },		// 50 kOhm
-{ DmmResistance,	5e5,	"%7.2f",	0x05,	{0x04, 0xC0,0x21,0x14,0x83,0x85,0x01,0x08,0x15,0x00,0xF8, 0x00,0x00,0x00,0x60,0x00, 0x94,0x80,0xD3,0x3F,0xAC}, 1e6 / 0.9 / 0x800000 },		// 500 kOhm
-{ DmmResistance,	5e6,	"%7.4f",	0x05,	{0x04, 0xC0,0x21,0x14,0x93,0x85,0x01,0x08,0x15,0x55,0xF8, 0x00,0x00,0x00,0x80,0x00, 0x86,0x80,0xD1,0x3F,0xAC}, 6e6 / 0.9 / 0x800000 },		// 5 MOhm
-{ DmmResistance,	5e7,	"%7.3f",	0x05,	{0x04, 0xC0,0x21,0x14,0x93,0x85,0x01,0x08,0x15,0x55,0xF8, 0x00,0x08,0x00,0x00,0x00, 0x86,0x80,0xD1,0x3F,0xAC}, 6e7 / 0.9 / 0x800000 },		// 50 MOhm
-
-// Measure type,	FSR,	fmt,		sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
-{ DmmResistance4W,	5e2,	"%7.2f",	0x05,	{0x04, 0xC0,0x21,0x14,0x83,0xA7,0x01,0x08,0x15,0x00,0xF8, 0x00,0x00,0x06,0x00,0x00, 0x94,0x80,0xD2,0x3F,0xAC}, 1e3 / 0.9 / 0x800000 },		// 500 Ohm
-{ DmmResistance4W,	5e3,	"%7.4f",	0x05,	{0x04, 0xC0,0x21,0x14,0x83,0xA7,0x01,0x08,0x15,0x00,0xF8, 0x00,0x00,0x60,0x00,0x00, 0x94,0x80,0xD3,0x3F,0xAC}, 1e4 / 0.9 / 0x800000 },		// 5 kOhm
-{ DmmResistance4W,	5e4,	"%7.3f",	0x05,	{0x04, 0xC0,0x21,0x14,0x83,0xA7,0x01,0x08,0x15,0x00,0xF8, 0x00,0x00,0x00,0x06,0x00, 0x94,0x80,0xD3,0x3F,0xAC}, 1e5 / 0.9 / 0x800000 },		// 50 kOhm
-
-// Measure type,	FSR,	fmt,		sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
-{ DmmCapacitance,	5e-8,	"%7.3f",	0x05,	{0x01, 0x70,0x21,0x14,0x8B,0x01,0x11,0x08,0x15,0x31,0xF8, 0x00,0x00,0x00,0x08,0x00, 0x9A,0x80,0xD7,0x33,0xA8}, 2.5e-12 },					// 50nF (Mode I - CTx)
-{ DmmCapacitance,	5e-7,	"%7.2f",	0x05,	{0x01, 0x70,0x21,0x14,0x8B,0x01,0x11,0x08,0x15,0x31,0xF8, 0x00,0x00,0x00,0x08,0x00, 0x9A,0x80,0xD7,0x33,0xA8}, 2.5e-12 },					// 500nF
-{ DmmCapacitance,	5e-6,	"%7.4f",	0x05,	{0x01, 0x70,0x21,0x14,0x8B,0x01,0x11,0x08,0x15,0x31,0xF8, 0x00,0x00,0x00,0x08,0x00, 0x9A,0x80,0xD7,0x33,0xA8}, 2.5e-12 },					// 5uF
-{ DmmCapacitance,	5e-5,	"%7.3f",	0x05,	{0x01, 0x70,0x21,0x14,0x8B,0x01,0x11,0x08,0x15,0x31,0xF8, 0x00,0x00,0x80,0x00,0x00, 0x9A,0x80,0xD7,0x33,0xA8}, 2e-11 },						// 50uF
-{ DmmCapacitance,	5e-4,	"%7.2f",	0x05,	{0x01, 0x70,0x21,0x04,0x8A,0xA5,0x00,0x00,0x00,0x55,0x00, 0x00,0x08,0x08,0x00,0x00, 0x8E,0x00,0xC2,0x0E,0x20}, 6.7e-11 },					// 500 uF
-{ DmmCapacitance,	5e-3,	"%7.4f",	0x05,	{0x01, 0x50,0x21,0x00,0x00,0x00,0x11,0x00,0x50,0x11,0x00, 0x00,0x00,0x08,0x00,0x00, 0x9A,0x00,0xC2,0x3C,0x20}, 1.33e-9 },					// 5 mF
-{ DmmCapacitance,	5e-2,	"%7.3f",	0x05,	{0x01, 0x50,0x21,0x00,0x00,0x00,0x11,0x00,0x50,0x11,0x00, 0x00,0x00,0x08,0x00,0x00, 0x9A,0x00,0xC2,0x3C,0x20}, 1.33e-9 },					// 10 mF
-
-// Measure type,	FSR,	fmt,		sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
-{ DmmFrequency,		1e7,	"%8.1f",	0x05,	{0x01, 0xC8,0xDE,0x07,0x93,0x85,0x11,0x08,0x15,0x55,0xF8, 0x00,0x00,0x00,0x00,0x00, 0x80,0x80,0xD7,0x33,0xAC}, 1e0 },						// Frequency
-
-// Measure type,	FSR,	fmt,		sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
-{ DmmTemperature,	8e2,	"%+7.2f",	0x01,	{0x04, 0xC0,0xDE,0x14,0x8B,0x85,0x11,0x08,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x08, 0x81,0x80,0xC7,0x33,0xA8}, 1.25e1 / 1.8 / 0x800000 },	// Temperature (thermo couple)
-
-// Measure type,	FSR,	fmt,		sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
-{ DmmContinuity,	5e2,	"%7.3f",	0x05,	{0x04, 0x60,0x62,0x13,0x83,0x85,0x01,0x08,0x15,0x00,0xF8, 0x00,0x40,0x06,0x00,0x00, 0x94,0x80,0xD2,0x3F,0xAC}, 1e3 / 0.9 / 0x800000 },		// Continuity
-
-// Measure type,	FSR,	fmt,		sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
-{ DmmDiode,			3e0,	"%7.4f",	0x05,	{0x04, 0x10,0x62,0x13,0x8B,0x8D,0x11,0x08,0x15,0x11,0xF8, 0x00,0x00,0x08,0x00,0x00, 0x86,0x80,0xE2,0x33,0xAC}, 1e-6 / 1.08 }				// Diode
+// Measure type,	FSR,	sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
+{ DmmDCVoltage,		5e-2,	0x01,	{0x04, 0xC0,0x21,0x14,0x8B,0x35,0x11,0x08,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x08, 0x81,0x80,0xC7,0x3C,0xA8}, 125e-3 / 1.8 / 0x800000 },	// 50 mV DC
+{ DmmDCVoltage,		5e-1,	0x01,	{0x04, 0xC0,0x21,0x14,0x8B,0x85,0x11,0x08,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x08, 0x81,0x80,0xC7,0x33,0xA8}, 125e-2 / 1.8 / 0x800000 },	// 500 mV DC
+{ DmmDCVoltage,		5e0,	0x21,	{0x04, 0xC0,0x21,0x14,0x8B,0x01,0x11,0x08,0x15,0x31,0xF8, 0x20,0x00,0x00,0x90,0x28, 0xA0,0x80,0xC7,0x33,0xA8}, 125e-1 / 1.8 / 0x800000 },	// 5 V DC
+{ DmmDCVoltage,		5e1,	0x21,	{0x04, 0xC0,0x21,0x14,0x8B,0x01,0x11,0x08,0x15,0x31,0xF8, 0x20,0x00,0x00,0x09,0x28, 0xA0,0x80,0xC7,0x33,0xA8}, 125e0  / 1.8 / 0x800000 },	// 50 V DC
+{ DmmDCVoltage,		5e2,	0x21,	{0x04, 0xC0,0x21,0x14,0x8B,0x01,0x11,0x08,0x15,0x31,0xF8, 0x20,0x00,0x90,0x00,0x28, 0xA0,0x80,0xC7,0x33,0xA8}, 125e1  / 1.8 / 0x800000 },	// 500 V DC
+{ DmmDCVoltage,		1e3,	0x21,	{0x04, 0xC0,0x21,0x14,0x8B,0x09,0x01,0x08,0x15,0x31,0xF8, 0x20,0x00,0x90,0x00,0x28, 0xA0,0x80,0xC7,0x33,0xA8}, 125e1  / 0.9 / 0x800000 },	// 1kV DC
+
+// Measure type,	FSR,	sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
+{ DmmACVoltage,		5e-1,	0x01,	{0x11, 0x10,0xDD,0x00,0x00,0x45,0x00,0x88,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x08, 0x91,0x80,0xC7,0x3C,0xA0}, 1e-5 },						// 500 mV AC
+{ DmmACVoltage,		5e0,	0x21,	{0x11, 0x10,0xDD,0x00,0x00,0x4D,0x00,0x88,0x15,0x31,0xF8, 0x22,0x00,0x00,0xD0,0x88, 0xA0,0xE9,0xC7,0x38,0x20}, 1e-4 },						// 5 V AC
+{ DmmACVoltage,		5e1,	0x21,	{0x11, 0x10,0xDD,0x00,0x00,0x4D,0x00,0x88,0x15,0x31,0xF8, 0x22,0x00,0x00,0x09,0x28, 0xA0,0xFF,0xC7,0x38,0x20}, 1e-3 },						// 50 V AC
+{ DmmACVoltage,		5e2,	0x21,	{0x11, 0x10,0xDD,0x00,0x00,0x4D,0x00,0x88,0x15,0x31,0xF8, 0x22,0x00,0x90,0x00,0x28, 0xA0,0x80,0xC7,0x38,0x20}, 1e-2 },						// 500 V AC
+{ DmmACVoltage,		7.5e2,	0x21,	{0x11, 0x10,0xDD,0x00,0x00,0x4D,0x00,0x88,0x15,0x31,0xF8, 0x22,0x00,0x90,0x00,0x28, 0xA0,0x80,0xC7,0x38,0x20}, 1e-2 },						// 750 V AC
+
+// Measure type,	FSR,	sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
+{ DmmDCCurrent,		5e-4,	0x20,	{0x04, 0xC0,0x21,0x14,0x8B,0x35,0x11,0x08,0x15,0x11,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0xAC}, 125e-5 / 1.8 / 0x800000 },	// 500uA DC
+{ DmmDCCurrent,		5e-3,	0x20,	{0x04, 0xC0,0x21,0x14,0x8B,0x95,0x11,0x08,0x15,0x11,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x33,0xAC}, 125e-4 / 1.8 / 0x800000 },	// 5mA DC
+{ DmmDCCurrent,		5e-2,	0x22,	{0x04, 0xC0,0x21,0x14,0x8B,0x35,0x11,0x08,0x15,0x11,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0xAC}, 125e-3 / 1.8 / 0x800000 },	// 50mA DC
+{ DmmDCCurrent,		5e-1,	0x22,	{0x04, 0xC0,0x21,0x14,0x8B,0x95,0x11,0x08,0x15,0x11,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x33,0xAC}, 125e-2 / 1.8 / 0x800000 },	// 500mA DC
+{ DmmDCCurrent,		5e0,	0x29,	{0x04, 0xC0,0x21,0x14,0x8B,0x35,0x11,0x08,0x15,0x11,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0xAC}, 125e-1 / 1.8 / 0x800000 },	// 5 A DC
+{ DmmDCCurrent,		10e0,	0x29,	{0x04, 0xC0,0x21,0x14,0x8B,0x35,0x01,0x08,0x15,0x11,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0xAC}, 125e-1 / 0.9 / 0x800000 },	// 10 A DC
+
+// Measure type,	FSR,	sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
+{ DmmACCurrent,		5e-4,	0x20,	{0x11, 0x10,0xDD,0x12,0x00,0x45,0x01,0x88,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0x20}, 1e-8 / 1.08 },				// 500 uA AC
+{ DmmACCurrent,		5e-3,	0x20,	{0x11, 0x10,0xDD,0x12,0x00,0x45,0x00,0x88,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0xA0}, 1e-7 / 2.16 },				// 5 mA AC
+{ DmmACCurrent,		5e-2,	0x22,	{0x11, 0x10,0xDD,0x12,0x00,0x45,0x01,0x88,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0x20}, 1e-6 / 1.08 },				// 50 mA AC
+{ DmmACCurrent,		5e-1,	0x22,	{0x11, 0x10,0xDD,0x12,0x00,0x45,0x00,0x88,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0xA0}, 1e-5 / 2.16 },				// 500 mA AC
+{ DmmACCurrent,		5e0,	0x29,	{0x11, 0x10,0xDD,0x12,0x00,0x45,0x01,0x88,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0x20}, 1e-4 / 1.08 },				// 5 A AC
+{ DmmACCurrent,		10e0,	0x29,	{0x11, 0x10,0xDD,0x12,0x00,0x45,0x00,0x88,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x00, 0xA0,0x80,0xC7,0x3D,0xA0}, 1e-4 / 2.16 },				// 10 A AC
+
+// Measure type,	FSR,	sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
+{ DmmResistance,	5e1,	0x05,	{0x04, 0x60,0x62,0x13,0x83,0x85,0x01,0x08,0x15,0x00,0xF8, 0x00,0x40,0x06,0x00,0x00, 0x94,0x80,0xD2,0x3F,0xAC}, 1e3 / 0.9 / 0x800000 },		// 50 Ohm
+{ DmmResistance,	5e2,	0x05,	{0x04, 0xC0,0x21,0x14,0x83,0x85,0x01,0x08,0x15,0x00,0xF8, 0x00,0x00,0x06,0x00,0x00, 0x94,0x80,0xD2,0x3F,0xAC}, 1e3 / 0.9 / 0x800000 },		// 500 Ohm
+{ DmmResistance,	5e3,	0x05,	{0x04, 0xC0,0x21,0x14,0x83,0x85,0x01,0x08,0x15,0x00,0xF8, 0x00,0x00,0x60,0x00,0x00, 0x94,0x80,0xD3,0x3F,0xAC}, 1e4 / 0.9 / 0x800000 },		// 5 kOhm
+{ DmmResistance,	5e4,	0x05,	{0x04, 0xC0,0x21,0x14,0x83,0x85,0x01,0x08,0x15,0x00,0xF8, 0x00,0x00,0x00,0x06,0x00, 0x94,0x80,0xD3,0x3F,0xAC}, 1e5 / 0.9 / 0x800000 },		// 50 kOhm
+{ DmmResistance,	5e5,	0x05,	{0x04, 0xC0,0x21,0x14,0x83,0x85,0x01,0x08,0x15,0x00,0xF8, 0x00,0x00,0x00,0x60,0x00, 0x94,0x80,0xD3,0x3F,0xAC}, 1e6 / 0.9 / 0x800000 },		// 500 kOhm
+{ DmmResistance,	5e6,	0x05,	{0x04, 0xC0,0x21,0x14,0x93,0x85,0x01,0x08,0x15,0x55,0xF8, 0x00,0x00,0x00,0x80,0x00, 0x86,0x80,0xD1,0x3F,0xAC}, 6e6 / 0.9 / 0x800000 },		// 5 MOhm
+{ DmmResistance,	5e7,	0x05,	{0x04, 0xC0,0x21,0x14,0x93,0x85,0x01,0x08,0x15,0x55,0xF8, 0x00,0x08,0x00,0x00,0x00, 0x86,0x80,0xD1,0x3F,0xAC}, 6e7 / 0.9 / 0x800000 },		// 50 MOhm
+
+// Measure type,	FSR,	sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
+{ DmmResistance4W,	5e2,	0x05,	{0x04, 0xC0,0x21,0x14,0x83,0xA7,0x01,0x08,0x15,0x00,0xF8, 0x00,0x00,0x06,0x00,0x00, 0x94,0x80,0xD2,0x3F,0xAC}, 1e3 / 0.9 / 0x800000 },		// 500 Ohm
+{ DmmResistance4W,	5e3,	0x05,	{0x04, 0xC0,0x21,0x14,0x83,0xA7,0x01,0x08,0x15,0x00,0xF8, 0x00,0x00,0x60,0x00,0x00, 0x94,0x80,0xD3,0x3F,0xAC}, 1e4 / 0.9 / 0x800000 },		// 5 kOhm
+{ DmmResistance4W,	5e4,	0x05,	{0x04, 0xC0,0x21,0x14,0x83,0xA7,0x01,0x08,0x15,0x00,0xF8, 0x00,0x00,0x00,0x06,0x00, 0x94,0x80,0xD3,0x3F,0xAC}, 1e5 / 0.9 / 0x800000 },		// 50 kOhm
+
+// Measure type,	FSR,	sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
+{ DmmCapacitance,	5e-8,	0x05,	{0x01, 0x70,0x21,0x14,0x8B,0x01,0x11,0x08,0x15,0x31,0xF8, 0x00,0x00,0x00,0x08,0x00, 0x9A,0x80,0xD7,0x33,0xA8}, 2.5e-12 },					// 50nF (Mode I - CTx)
+{ DmmCapacitance,	5e-7,	0x05,	{0x01, 0x70,0x21,0x14,0x8B,0x01,0x11,0x08,0x15,0x31,0xF8, 0x00,0x00,0x00,0x08,0x00, 0x9A,0x80,0xD7,0x33,0xA8}, 2.5e-12 },					// 500nF
+{ DmmCapacitance,	5e-6,	0x05,	{0x01, 0x70,0x21,0x14,0x8B,0x01,0x11,0x08,0x15,0x31,0xF8, 0x00,0x00,0x00,0x08,0x00, 0x9A,0x80,0xD7,0x33,0xA8}, 2.5e-12 },					// 5uF
+{ DmmCapacitance,	5e-5,	0x05,	{0x01, 0x70,0x21,0x14,0x8B,0x01,0x11,0x08,0x15,0x31,0xF8, 0x00,0x00,0x80,0x00,0x00, 0x9A,0x80,0xD7,0x33,0xA8}, 2e-11 },						// 50uF
+{ DmmCapacitance,	5e-4,	0x05,	{0x01, 0x70,0x21,0x04,0x8A,0xA5,0x00,0x00,0x00,0x55,0x00, 0x00,0x08,0x08,0x00,0x00, 0x8E,0x00,0xC2,0x0E,0x20}, 6.7e-11 },					// 500 uF
+{ DmmCapacitance,	5e-3,	0x05,	{0x01, 0x50,0x21,0x00,0x00,0x00,0x11,0x00,0x50,0x11,0x00, 0x00,0x00,0x08,0x00,0x00, 0x9A,0x00,0xC2,0x3C,0x20}, 1.33e-9 },					// 5 mF
+{ DmmCapacitance,	5e-2,	0x05,	{0x01, 0x50,0x21,0x00,0x00,0x00,0x11,0x00,0x50,0x11,0x00, 0x00,0x00,0x08,0x00,0x00, 0x9A,0x00,0xC2,0x3C,0x20}, 1.33e-9 },					// 10 mF
+
+// Measure type,	FSR,	sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
+{ DmmFrequency,		1e7,	0x05,	{0x01, 0xC8,0xDE,0x07,0x93,0x85,0x11,0x08,0x15,0x55,0xF8, 0x00,0x00,0x00,0x00,0x00, 0x80,0x80,0xD7,0x33,0xAC}, 1e0 },						// Frequency
+
+// Measure type,	FSR,	sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
+{ DmmTemperature,	8e2,	0x01,	{0x04, 0xC0,0xDE,0x14,0x8B,0x85,0x11,0x08,0x15,0x31,0xF8, 0x00,0x00,0x00,0x00,0x08, 0x81,0x80,0xC7,0x33,0xA8}, 1.25e1 / 1.8 / 0x800000 },	// Temperature (thermo couple)
+
+// Measure type,	FSR,	sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
+{ DmmContinuity,	5e2,	0x05,	{0x04, 0x60,0x62,0x13,0x83,0x85,0x01,0x08,0x15,0x00,0xF8, 0x00,0x40,0x06,0x00,0x00, 0x94,0x80,0xD2,0x3F,0xAC}, 1e3 / 0.9 / 0x800000 },		// Continuity
+
+// Measure type,	FSR,	sw,		 INTE  R20, R21, R22, R23, R24, R25, R26, R27, R28, R29,  R2A, R2B, R2C, R2D, R2E,  R2F, R30, R31, R32, R33,   mult
+{ DmmDiode,			3e0,	0x05,	{0x04, 0x10,0x62,0x13,0x8B,0x8D,0x11,0x08,0x15,0x11,0xF8, 0x00,0x00,0x08,0x00,0x00, 0x86,0x80,0xE2,0x33,0xAC}, 1e-6 / 1.08 }				// Diode
 };
 
 #if 0
@@ -108,15 +108,76 @@ struct _THERMO {
  * PT1000:	PT100 * 10
  */
 
-const char * const dmmranges[] = {
-	"50mV DC", "500mV DC", "5V DC", "50V DC", "500V DC", "1kV DC",
-	"500mV AC", "5V AC", "50V AC", "500V AC", "750V AC",
-	"500uA DC", "5mA DC", "50mA DC", "500mA DC", "5A DC", "10A DC",
-	"500uA AC", "5mA AC", "50mA AC", "500mA AC", "5A AC", "10A AC",
-	"50 Ohm", "500 Ohm", "5 kOhm", "50 kOhm", "500 kOhm", "5 MOhm", "50 MOhm",
-	"500 Ohm 4W", "5 kOhm 4W", "50 kOhm 4W",
-	"50 nF", "500 nF", "5 uF", "50 uF", "500 uF", "5 mF", "50 mF",
-	"FREQ", "TEMP", "CONT", "DIODE"
+/*
+ * Display descriptors, in the order of dmmcfg[]: everything the UI needs for a reading,
+ * so the unit prefix, scale factor and limits are not derived from the range each time.
+ * The unit of SCALE_TEMP depends on tempunits, see tempdisp[].
+ */
+const DMMDISP dmmdisp[] = {
+// name,			unit,	factor,	FS,		fmt,				flags
+{ "50mV DC",		"mV=",	1e3,	50,		{ 7, 3, NUM_SIGN },	DISP_DC | DISP_VOLT },
+{ "500mV DC",		"mV=",	1e3,	500,	{ 7, 2, NUM_SIGN },	DISP_DC | DISP_VOLT },
+{ "5V DC",			"V=",	1e0,	5,		{ 7, 4, NUM_SIGN },	DISP_DC | DISP_VOLT },
+{ "50V DC",			"V=",	1e0,	50,		{ 7, 3, NUM_SIGN },	DISP_DC | DISP_VOLT },
+{ "500V DC",		"V=",	1e0,	500,	{ 7, 2, NUM_SIGN },	DISP_DC | DISP_VOLT },
+{ "1kV DC",			"kV=",	1e-3,	1,		{ 7, 4, NUM_SIGN },	DISP_DC | DISP_VOLT },
+
+{ "500mV AC",		"mV~",	1e3,	500,	{ 7, 2, 0 },		DISP_AC | DISP_VOLT },
+{ "5V AC",			"V~",	1e0,	5,		{ 7, 4, 0 },		DISP_AC | DISP_VOLT },
+{ "50V AC",			"V~",	1e0,	50,		{ 7, 3, 0 },		DISP_AC | DISP_VOLT },
+{ "500V AC",		"V~",	1e0,	500,	{ 7, 2, 0 },		DISP_AC | DISP_VOLT },
+{ "750V AC",		"V~",	1e0,	750,	{ 7, 2, 0 },		DISP_AC | DISP_VOLT },
+
+{ "500uA DC",		"uA=",	1e6,	500,	{ 7, 2, NUM_SIGN },	DISP_DC | DISP_CURR },
+{ "5mA DC",			"mA=",	1e3,	5,		{ 7, 4, NUM_SIGN },	DISP_DC | DISP_CURR },
+{ "50mA DC",		"mA=",	1e3,	50,		{ 7, 3, NUM_SIGN },	DISP_DC | DISP_CURR },
+{ "500mA DC",		"mA=",	1e3,	500,	{ 7, 2, NUM_SIGN },	DISP_DC | DISP_CURR },
+{ "5A DC",			"A=",	1e0,	5,		{ 7, 4, NUM_SIGN },	DISP_DC | DISP_CURR },
+{ "10A DC",			"A=",	1e0,	10,		{ 7, 3, NUM_SIGN },	DISP_DC | DISP_CURR },
+
+{ "500uA AC",		"uA~",	1e6,	500,	{ 7, 2, 0 },		DISP_AC | DISP_CURR },
+{ "5mA AC",			"mA~",	1e3,	5,		{ 7, 4, 0 },		DISP_AC | DISP_CURR },
+{ "50mA AC",		"mA~",	1e3,	50,		{ 7, 3, 0 },		DISP_AC | DISP_CURR },
+{ "500mA AC",		"mA~",	1e3,	500,	{ 7, 2, 0 },		DISP_AC | DISP_CURR },
+{ "5A AC",			"A~",	1e0,	5,		{ 7, 4, 0 },		DISP_AC | DISP_CURR },
+{ "10A AC",			"A~",	1e0,	10,		{ 7, 3, 0 },		DISP_AC | DISP_CURR },
+
+{ "50 Ohm",			"Ohm",	1e0,	50,		{ 7, 3, 0 },		DISP_RES },
+{ "500 Ohm",		"Ohm",	1e0,	500,	{ 7, 2, 0 },		DISP_RES },
+{ "5 kOhm",			"kOhm",	1e-3,	5,		{ 7, 4, 0 },		DISP_RES },
+{ "50 kOhm",		"kOhm",	1e-3,	50,		{ 7, 3, 0 },		DISP_RES },
+{ "500 kOhm",		"kOhm",	1e-3,	500,	{ 7, 2, 0 },		DISP_RES },
+{ "5 MOhm",			"MOhm",	1e-6,	5,		{ 7, 4, 0 },		DISP_RES },
+{ "50 MOhm",		"MOhm",	1e-6,	50,		{ 7, 3, 0 },		DISP_RES },
+
+{ "500 Ohm 4W",		"Ohm",	1e0,	500,	{ 7, 2, 0 },		DISP_RES | DISP_FRES },
+{ "5 kOhm 4W",		"kOhm",	1e-3,	5,		{ 7, 4, 0 },		DISP_RES | DISP_FRES },
+{ "50 kOhm 4W",		"kOhm",	1e-3,	50,		{ 7, 3, 0 },		DISP_RES | DISP_FRES },
+
+{ "50 nF",			"nF",	1e9,	50,		{ 7, 3, 0 },		DISP_CAP },
+{ "500 nF",			"nF",	1e9,	500,	{ 7, 2, 0 },		DISP_CAP },
+{ "5 uF",			"uF",	1e6,	5,		{ 7, 4, 0 },		DISP_CAP },
+{ "50 uF",			"uF",	1e6,	50,		{ 7, 3, 0 },		DISP_CAP },
+{ "500 uF",			"uF",	1e6,	500,	{ 7, 2, 0 },		DISP_CAP },
+{ "5 mF",			"mF",	1e3,	5,		{ 7, 4, 0 },		DISP_CAP },
+{ "50 mF",			"mF",	1e3,	50,		{ 7, 3, 0 },		DISP_CAP },
+
+{ "FREQ",			"Hz",	1e0,	1e7,	{ 8, 1, 0 },		DISP_FREQ },
+
+{ "TEMP",			"'C",	1e0,	800,	{ 7, 2, NUM_SIGN },	DISP_TEMP },
+
+{ "CONT",			"Ohm",	1e0,	500,	{ 7, 3, 0 },		DISP_RES | DISP_CONT },
+
+{ "DIODE",			"V",	1e0,	3,		{ 7, 4, 0 },		DISP_DIOD }
+};
+
+_Static_assert( sizeof(dmmdisp) / sizeof(dmmdisp[0]) == sizeof(dmmcfg) / sizeof(dmmcfg[0]), "dmmdisp[] must have one entry per dmmcfg[] scale" );
+_Static_assert( sizeof(dmmcfg) / sizeof(dmmcfg[0]) == SCALE_DIODE + 1, "dmmcfg[] must have one entry per SCALE_xxx" );
+
+static const DMMDISP tempdisp[] = {		// SCALE_TEMP by tempunits
+{ "TEMP",			"'C",	1e0,	800,	{ 7, 2, NUM_SIGN },	DISP_TEMP },
+{ "TEMP",			"'F",	1e0,	800,	{ 7, 2, NUM_SIGN },	DISP_TEMP },
+{ "TEMP",			"K",	1e0,	800,	{ 7, 2, NUM_SIGN },	DISP_TEMP }
 };
 
 enum {
@@ -127,6 +188,9 @@ enum {
 };
 
 double dMeasuredVal[3];
+
+double dFastVal = 0;				// result of the last single conversion, before averaging
+uint32_t nFastCount = 0;			// incremented with each new dFastVal
 uint32_t currCTA, currCTB, currCTC;
 double currAD1, currAD2, currAD3, currRMS;
 uint8_t DMM_Status = 0;
@@ -453,12 +517,6 @@ uint8_t	DMM_GetTempUnits( void )
 	return tempunits;
 }
 
-const char *DMM_GetFormat( int idxScale )
-{
-	if( DMM_isScale( idxScale ) != ERRVAL_SUCCESS ) return "";
-	return dmmcfg[idxScale].fmt;
-}
-
 /***	DMM_SetUseCalib
  **	Parameters:
  **      uint8_t f
@@ -684,86 +742,24 @@ uint8_t DMM_isNAN( double dVal )
 	return ( dVal == NAN ) || isnan( dVal );
 }
 
-/***	DMM_GetScaleUnit
+/***	DMM_GetDisplay
  **	Parameters:
  **		int idxScale        - the Scale index
- **      double *pdScaleFact - pointer to a variable to get the scale factor value
- **      char *szUnitPrefix  - string to get the Unit prefix corresponding to the multiple / submultiple
- **      char *szUnit        - string to get the Unit
  **	Return Value:
- **		uint8_t
- **          ERRVAL_SUCCESS                  0       // success
- **          ERRVAL_DMM_IDXCONFIG            0xFC    // wrong scale index
+ **		const DMMDISP *     - display descriptor of the scale
+ **          NULL            - wrong scale index
  **	Description:
- **		The function identifies the Measuring unit data (scale factor, Unit prefix and Unit) for the specified scale.
- **      It uses scale type to identify the Unit.
- **      It uses scale range to identify the Unit prefix (u, m, k, M) and the corresponding scale factor.
- **      The scale factor is the value that must multiply the value to convert from the base Unit to the prefixed unit (for example from V to mV)
- **      The function returns ERRVAL_DMM_IDXCONFIG if the provided Scale is not valid.
+ **		The function returns the display data of the specified scale: range name, prefixed unit,
+ **      the scale factor to convert from the base unit to the prefixed unit (for example from V to mV),
+ **      the full scale range in the prefixed unit, the display format and the mode flags.
+ **      The descriptors are constant, so the pointer can be kept as long as the scale does not change
+ **      (for SCALE_TEMP, also the temperature units).
  */
-uint8_t DMM_GetScaleUnit( uint8_t scale, double *pdScaleFact, char *szUnitPrefix, char *szUnit, char *szRange )
+const DMMDISP *DMM_GetDisplay( int idxScale )
 {
-	uint8_t bResult = DMM_isScale( scale );
-	if( bResult == ERRVAL_SUCCESS )				// valid idxScale
-	{
-		DMMCFG const *cfg = &dmmcfg[scale];
-
-		if( scale == SCALE_TEMP )
-		{
-			*pdScaleFact = 1e0;	szUnitPrefix[0] = 0;
-		}
-
-		if( pdScaleFact && szUnitPrefix )
-		{
-			if( scale == SCALE_FREQ ||
-				scale == SCALE_TEMP )		{ *pdScaleFact = 1e0;	szUnitPrefix[0] = 0; }
-			else if( cfg->range < 1e-9 )	{ *pdScaleFact = 1e12;	szUnitPrefix[0] = 'p'; }
-			else if( cfg->range < 1e-6 )	{ *pdScaleFact = 1e9;	szUnitPrefix[0] = 'n'; }
-			else if( cfg->range < 1e-3 )	{ *pdScaleFact = 1e6;	szUnitPrefix[0] = 'u'; }
-			else if( cfg->range < 1e0 )		{ *pdScaleFact = 1e3;	szUnitPrefix[0] = 'm'; }
-			else if( cfg->range < 1e3 )		{ *pdScaleFact = 1e0;	szUnitPrefix[0] =  0 ; }
-			else if( cfg->range < 1e6 )		{ *pdScaleFact = 1e-3;	szUnitPrefix[0] = 'k'; }
-			else if( cfg->range < 1e9 )		{ *pdScaleFact = 1e-6;	szUnitPrefix[0] = 'M'; }
-			else							{ *pdScaleFact = 1e-9;	szUnitPrefix[0] = 'G'; }
-			szUnitPrefix[1] = 0;
-		}
-
-		if( szUnit )
-		{
-			switch( cfg->mode )
-			{
-			case DmmDCVoltage:			strcpy( szUnit, "V=" ); break;
-			case DmmDCCurrent:			strcpy( szUnit, "A=" ); break;
-			case DmmACVoltage:			strcpy( szUnit, "V~" ); break;
-			case DmmACCurrent:			strcpy( szUnit, "A~" ); break;
-
-			case DmmResistance:
-			case DmmResistance4W:
-			case DmmContinuity:			strcpy( szUnit, "Ohm" ); break;
-
-			case DmmDiode:				strcpy( szUnit, "V" ); break;
-
-			case DmmTemperature:
-				switch( tempunits )
-				{
-				case TEMP_KELVIN:		strcpy( szUnit, "K" ); break;
-				case TEMP_FAHRENHEIT:	strcpy( szUnit, "'F" ); break;
-				default:				strcpy( szUnit, "'C" ); break;
-				}
-				break;
-
-			case DmmCapacitance:		strcpy( szUnit, "F" ); break;
-
-			case DmmFrequency:			strcpy( szUnit, "Hz" ); break;
-			}
-		}
-
-		if( szRange )
-		{
-			strcpy( szRange, dmmranges[scale] );
-		}
-	}
-	return bResult;
+	if( DMM_isScale( idxScale ) != ERRVAL_SUCCESS ) return NULL;
+	if( idxScale == SCALE_TEMP ) return &tempdisp[tempunits - TEMP_CELSIUS];
+	return &dmmdisp[idxScale];
 }
 
 static uint8_t DMM_ReadResults( uint8_t scale )
@@ -1048,6 +1044,12 @@ uint8_t DMM_Measure( uint8_t channel )
 	{
 		dValAvg[channel] += dVal;									// sum up (AC is already squared)
 		nAvgCount[channel] -= 1;									// decrement averaging loop counter
+
+		if( channel == 0 )
+		{
+			dFastVal = DMM_isAC( scale ) ? sqrt( dVal ) : dVal;
+			++nFastCount;
+		}
 	}
 
 	if( nAvgCount[channel] )										// more averaging passes to go?
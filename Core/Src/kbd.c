@@ -3,11 +3,22 @@
  *
  *  Created on: 06.08.2021
  *      Author: aziemer
+ *
+ *  The key matrix is scanned from the SysTick interrupt, one drive line per millisecond:
+ *  each tick reads the sense lines of the line driven in the previous tick (1 ms settling time),
+ *  releases it and drives the next one. Every full scan (5 ms) runs the per-key debouncing
+ *  and puts press / release / repeat events into a single producer / single consumer FIFO,
+ *  which the keys task empties with KBD_GetEvent() without ever waiting.
  */
 
 #include "main.h"
 #include "gpio.h"
 #include "kbd.h"
+#include "sched.h"
+
+#define KBD_LINES			5
+#define KBD_KEYS			( KBD_LINES * KBD_LINES )
+#define KBD_FIFO_SIZE		16					// power of 2
 
 static GPIO_TypeDef *drive_port[] = {	KBD_COL1_GPIO_Port,	KBD_COL2_GPIO_Port,	KBD_COL3_GPIO_Port,	KBD_COL4_GPIO_Port,	KBD_COL5_GPIO_Port };
 static uint16_t drive_pin[] = {			KBD_COL1_Pin,		KBD_COL2_Pin,		KBD_COL3_Pin,		KBD_COL4_Pin,		KBD_COL5_Pin };
@@ -15,13 +26,27 @@ static uint16_t drive_pin[] = {			KBD_COL1_Pin,		KBD_COL2_Pin,		KBD_COL3_Pin,		K
 static GPIO_TypeDef *sense_port[] = {	KBD_ROW1_GPIO_Port,	KBD_ROW2_GPIO_Port,	KBD_ROW3_GPIO_Port,	KBD_ROW4_GPIO_Port,	KBD_ROW5_GPIO_Port };
 static uint16_t sense_pin[] = {			KBD_ROW1_Pin,		KBD_ROW2_Pin,		KBD_ROW3_Pin,		KBD_ROW4_Pin,		KBD_ROW5_Pin };
 
+static volatile uint8_t scanning = 0;
+static uint8_t row = 0;						// drive line currently low
+static uint32_t raw = 0;					// bit key-1: pressed in the scan in progress
+static volatile uint32_t state = 0;			// bit key-1: debounced state
+static uint8_t bounce[KBD_KEYS];			// scans the raw state differs from the debounced one
+static uint8_t repeatKey = 0;				// last key pressed, while held
+static uint16_t repeatTime = 0;				// [ms] until its next repeat event
+
+static volatile uint8_t fifo[KBD_FIFO_SIZE];
+static volatile uint8_t head = 0;			// written by the interrupt only
+static volatile uint8_t tail = 0;			// written by KBD_GetEvent() only
+
 /* Configure KBD drive and sense GPIOs */
 void KBD_Init( void )
 {
 	GPIO_InitTypeDef GPIO_InitStruct = { .Speed = GPIO_SPEED_FREQ_LOW };
 	uint8_t i;
 
-	for( i = 0; i < 5; ++i )
+	scanning = 0;
+
+	for( i = 0; i < KBD_LINES; ++i )
 	{
 		/* Configure drive pins as open-drain outputs, and set high -> Hi-Z */
 		GPIO_InitStruct.Pin = drive_pin[i];
@@ -39,29 +64,134 @@ void KBD_Init( void )
 
 		HAL_GPIO_WritePin( sense_port[i], sense_pin[i], GPIO_PIN_SET );
 	}
+
+	row = KBD_LINES - 1;		// drive PC13 first, as it seems to always be low (?)
+	raw = 0;
+	HAL_GPIO_WritePin( drive_port[row], drive_pin[row], GPIO_PIN_RESET );
+
+	scanning = 1;
+}
+
+static void PutEvent( uint8_t event )		// interrupt context, drops the event if the FIFO is full
+{
+	uint8_t next = ( head + 1 ) & ( KBD_FIFO_SIZE - 1 );
+
+	if( next == tail )
+		return;
+
+	fifo[head] = event;
+	head = next;
+
+	SCHED_Signal( TASK_KEYS );
 }
 
-uint8_t KBD_Read( void )
+static void Debounce( void )				// once per full scan
 {
-	uint8_t key = 0, row, col;
+	uint32_t changed;
+	uint8_t i;
+
+	/*
+	 * A key on the PC13 line seems to pull its sense line low during the scan of all other lines,
+	 * so it hides the keys of the same sense line (the old scanner simply took the first key found).
+	 */
+	for( i = 0; i < KBD_LINES; ++i )
+		if( raw & ( 1UL << ( KBD_LINES * i + KBD_LINES - 1 ) ) )
+			raw &= ~( ( ( 1UL << ( KBD_LINES - 1 ) ) - 1 ) << ( KBD_LINES * i ) );
 
-	/* scan keyboard matrix */
-	for( row = 4; row < 5 && !key; --row )		// drive PC13 first, as it seems to always be low (?)
+	changed = raw ^ state;
+
+	for( i = 0; i < KBD_KEYS; ++i )
 	{
-		HAL_GPIO_WritePin( drive_port[row], drive_pin[row], GPIO_PIN_RESET );	// drive pin low
+		if( !( changed & ( 1UL << i ) ) )
+		{
+			bounce[i] = 0;
+			continue;
+		}
+
+		if( ++bounce[i] < KBD_DEBOUNCE )
+			continue;
+
+		bounce[i] = 0;
+		state ^= 1UL << i;
 
-		/* scan column pins for low value -> key pressed */
-		for( col = 0; col < 5; ++col )
+		if( state & ( 1UL << i ) )
 		{
-			if( HAL_GPIO_ReadPin( sense_port[col], sense_pin[col] ) == GPIO_PIN_RESET )
-			{
-				key = 1 + 5 * col + row;
-				break;
-			}
+			PutEvent( KEY_PRESS | ( i + 1 ) );
+			repeatKey = i + 1;
+			repeatTime = KBD_REPEAT_DELAY;
 		}
+		else
+		{
+			PutEvent( KEY_RELEASE | ( i + 1 ) );
+			if( repeatKey == i + 1 )
+				repeatKey = 0;
+		}
+	}
 
-		HAL_GPIO_WritePin( drive_port[row], drive_pin[row], GPIO_PIN_SET );		// make drive pin Hi-Z again
+	if( repeatKey )
+	{
+		if( repeatTime > KBD_SCAN_MS )
+			repeatTime -= KBD_SCAN_MS;
+		else
+		{
+			PutEvent( KEY_REPEAT | repeatKey );
+			repeatTime = KBD_REPEAT_RATE;
+		}
 	}
 
-	return key;
+	raw = 0;
+}
+
+void KBD_Tick( void )		// SysTick, every millisecond
+{
+	uint8_t col;
+
+	if( !scanning )
+		return;
+
+	/* scan sense pins for low value -> key pressed */
+	for( col = 0; col < KBD_LINES; ++col )
+	{
+		if( HAL_GPIO_ReadPin( sense_port[col], sense_pin[col] ) == GPIO_PIN_RESET )
+			raw |= 1UL << ( KBD_LINES * col + row );
+	}
+
+	HAL_GPIO_WritePin( drive_port[row], drive_pin[row], GPIO_PIN_SET );		// make drive pin Hi-Z again
+
+	if( row-- == 0 )		// full scan done
+	{
+		row = KBD_LINES - 1;
+		Debounce();
+	}
+
+	HAL_GPIO_WritePin( drive_port[row], drive_pin[row], GPIO_PIN_RESET );	// drive next pin low, read in the next tick
+}
+
+uint8_t KBD_GetEvent( void )		// KEY_PRESS / KEY_RELEASE / KEY_REPEAT | key, 0 if none
+{
+	uint8_t event;
+
+	if( tail == head )
+		return 0;
+
+	event = fifo[tail];
+	tail = ( tail + 1 ) & ( KBD_FIFO_SIZE - 1 );
+	return event;
+}
+
+void KBD_Flush( void )
+{
+	tail = head;
+}
+
+uint8_t KBD_Read( void )			// debounced key currently held (the lowest one), 0 if none
+{
+	uint32_t s = state;
+	uint8_t key;
+
+	for( key = 1; s; ++key, s >>= 1 )
+		if( s & 1 )
+			return key;
+
+	return 0;
 }
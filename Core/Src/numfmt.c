@@ -0,0 +1,179 @@
+/*
+ * numfmt.c
+ *
+ *  Created on: 19.10.2026
+ *      Author: aziemer
+ *
+ *  Number formatting without printf.
+ *
+ *  newlib-nano's float printf goes through soft-float dtoa for every digit and pulls several
+ *  KB of code. Readings are converted into a scaled integer once (one multiply), all digits
+ *  are then produced with integer arithmetic, directly into the caller's buffer.
+ *  The output matches printf's "%*.*f" and "%+1.*e" for the values used here, except that
+ *  a value rounding to zero is never printed as "-0".
+ */
+
+#include <math.h>
+
+#include "main.h"
+#include "tft.h"
+#include "numfmt.h"
+
+#define NUM_MAX		2000000000L		// saturation limit of NUM_Round()
+
+static const uint32_t decade[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+
+int32_t NUM_Round( double val, uint8_t decimals )		// val * 10^decimals, rounded and saturated
+{
+	if( isnan( val ) )
+		return 0;
+
+	val *= decade[ decimals < 9 ? decimals : 9 ];
+	if( val >= NUM_MAX )	return NUM_MAX;
+	if( val <= -NUM_MAX )	return -NUM_MAX;
+
+	return (int32_t)( val < 0 ? val - 0.5 : val + 0.5 );
+}
+
+/*
+ * val / 10^decimals as in printf( "%*.*f", width, decimals ), the NUM_SIGN flag adds the '+'.
+ * Returns the length of the string.
+ */
+uint8_t NUM_Fixed( char *str, int32_t val, uint8_t decimals, uint8_t width, uint8_t flags )
+{
+	char tmp[12], *p = tmp + sizeof(tmp);
+	uint32_t u = ( val < 0 ) ? -(uint32_t)val : (uint32_t)val;
+	char sign = ( val < 0 ) ? '-' : ( flags & NUM_SIGN ) ? '+' : 0;
+	uint8_t n = 0, len;
+
+	do
+	{
+		*--p = '0' + u % 10;
+		u /= 10;
+		if( ++n == decimals )
+			*--p = '.';
+	}
+	while( u || n <= decimals );		// at least one digit before the point
+
+	len = tmp + sizeof(tmp) - p + ( sign != 0 );
+	for( n = len; n < width; ++n )
+		*str++ = ' ';
+	if( sign )
+		*str++ = sign;
+	while( p < tmp + sizeof(tmp) )
+		*str++ = *p++;
+	*str = 0;
+
+	return ( len < width ) ? width : len;
+}
+
+uint8_t NUM_Format( char *str, double val, const NUMFMT *fmt )		// reading with the format of a scale
+{
+	return NUM_Fixed( str, NUM_Round( val, fmt->decimals ), fmt->decimals, fmt->width, fmt->flags );
+}
+
+/*
+ * val as in printf( "%+1.*e", digits ), i.e. "+5.0000e-02" for 4 digits (max. 8).
+ * Without NUM_SIGN, positive values have no sign.
+ */
+uint8_t NUM_Exp( char *str, double val, uint8_t digits, uint8_t flags )
+{
+	static const double big[] = { 1e1, 1e2, 1e4, 1e8, 1e16, 1e32, 1e64, 1e128, 1e256 };
+	char *start = str;
+	uint32_t mant;
+	int16_t e = 0;
+	int8_t i;
+
+	if( digits > 8 )
+		digits = 8;
+
+	if( signbit( val ) )
+	{
+		*str++ = '-';
+		val = -val;
+	}
+	else if( flags & NUM_SIGN )
+		*str++ = '+';
+
+	if( isnan( val ) || isinf( val ) )
+	{
+		const char *s = isnan( val ) ? "nan" : "inf";
+
+		while( *s )
+			*str++ = *s++;
+		*str = 0;
+		return str - start;
+	}
+
+	if( val != 0 )						// normalise to [1..10) with binary powers of ten
+	{
+		if( val >= 10 )
+		{
+			for( i = 8; i >= 0; --i )
+				if( val >= big[i] ) { val /= big[i]; e += 1 << i; }
+		}
+		else if( val < 1 )
+		{
+			for( i = 8; i >= 0; --i )
+				if( val * big[i] < 10 ) { val *= big[i]; e -= 1 << i; }
+		}
+	}
+
+	mant = val * decade[digits] + 0.5;
+	if( mant >= decade[digits+1] )		// rounded up to 10.000
+	{
+		mant /= 10;
+		++e;
+	}
+
+	str += NUM_Fixed( str, mant, digits, 0, 0 );
+	*str++ = 'e';
+	*str++ = ( e < 0 ) ? '-' : '+';
+	str += NUM_Uint( str, ( e < 0 ) ? -e : e, 2, '0' );
+
+	return str - start;
+}
+
+uint8_t NUM_Uint( char *str, uint32_t val, uint8_t width, char pad )	// printf( "%0*lu" ) or "%*lu"
+{
+	char tmp[10], *p = tmp + sizeof(tmp);
+	uint8_t n, len;
+
+	do
+	{
+		*--p = '0' + val % 10;
+		val /= 10;
+	}
+	while( val );
+
+	len = tmp + sizeof(tmp) - p;
+	for( n = len; n < width; ++n )
+		*str++ = pad;
+	while( p < tmp + sizeof(tmp) )
+		*str++ = *p++;
+	*str = 0;
+
+	return ( len < width ) ? width : len;
+}
+
+#ifdef TFT_BENCHMARK
+
+#include <stdio.h>
+
+void NUM_Benchmark( uint32_t result[2] )	// conversions/s of sprintf() (needs -u _printf_float) vs. NUM_Format()
+{
+	static const NUMFMT fmt = { 7, 3, NUM_SIGN };
+	char str[20];
+	uint32_t start, count;
+	double val;
+
+	for( count = 0, val = -12.3456, start = HAL_GetTick(); HAL_GetTick() - start < 1000; ++count, val += 0.001 )
+		sprintf( str, "%+7.3f", val );
+	result[0] = count * 1000 / ( HAL_GetTick() - start );
+
+	for( count = 0, val = -12.3456, start = HAL_GetTick(); HAL_GetTick() - start < 1000; ++count, val += 0.001 )
+		NUM_Format( str, val, &fmt );
+	result[1] = count * 1000 / ( HAL_GetTick() - start );
+}
+
+#endif
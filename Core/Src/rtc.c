@@ -35,6 +35,12 @@ void MX_RTC_Init( void )
 	{
 		Error_Handler();
 	}
+
+	/** Enable the second interrupt, it drives the clock display */
+	if( HAL_RTCEx_SetSecond_IT( &hrtc ) != HAL_OK )
+	{
+		Error_Handler();
+	}
 }
 
 void HAL_RTC_MspInit( RTC_HandleTypeDef *rtcHandle )
@@ -46,6 +52,10 @@ void HAL_RTC_MspInit( RTC_HandleTypeDef *rtcHandle )
 		__HAL_RCC_BKP_CLK_ENABLE( );
 		/* RTC clock enable */
 		__HAL_RCC_RTC_ENABLE( );
+
+		/* RTC interrupt Init */
+		HAL_NVIC_SetPriority( RTC_IRQn, 0, 0 );
+		HAL_NVIC_EnableIRQ( RTC_IRQn );
 	}
 }
 
@@ -55,6 +65,9 @@ void HAL_RTC_MspDeInit( RTC_HandleTypeDef *rtcHandle )
 	{
 		/* Peripheral clock disable */
 		__HAL_RCC_RTC_DISABLE( );
+
+		/* RTC interrupt Deinit */
+		HAL_NVIC_DisableIRQ( RTC_IRQn );
 	}
 }
 
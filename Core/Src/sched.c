@@ -0,0 +1,119 @@
+/*
+ * sched.c
+ *
+ *  Created on: 19.10.2026
+ *      Author: aziemer
+ *
+ *  Run-to-completion scheduler: a task is released by its period or by SCHED_Signal(), and the
+ *  released task with the highest priority (lowest id) runs next, until it returns. Tasks must
+ *  not block. A task starting later than its deadline counts as missed, execution times are
+ *  taken with the DWT cycle counter.
+ *  With nothing released the CPU sleeps until the next interrupt, at most one SysTick.
+ */
+
+#include "main.h"
+#include "sched.h"
+
+static const TASK *tasks = NULL;
+static TASK_STATS stats[TASK_COUNT];
+static volatile uint8_t released[TASK_COUNT];
+static volatile uint32_t releaseTime[TASK_COUNT];	// HAL_GetTick() of the release
+static uint32_t nextRelease[TASK_COUNT];			// periodic tasks
+
+void SCHED_Init( const TASK *table )
+{
+	uint32_t now = HAL_GetTick();
+	uint8_t t;
+
+	tasks = table;
+	for( t = 0; t < TASK_COUNT; ++t )
+		nextRelease[t] = now;
+
+	SCHED_ResetStats();
+}
+
+void SCHED_Signal( uint8_t task )
+{
+	if( task >= TASK_COUNT || released[task] )
+		return;
+
+	releaseTime[task] = HAL_GetTick();
+	released[task] = 1;
+}
+
+static void Release( uint32_t now )		// periodic tasks due
+{
+	uint8_t t;
+
+	for( t = 0; t < TASK_COUNT; ++t )
+	{
+		if( !tasks[t].period || (int32_t)( now - nextRelease[t] ) < 0 )
+			continue;
+
+		if( !released[t] )
+		{
+			releaseTime[t] = nextRelease[t];
+			released[t] = 1;
+		}
+
+		nextRelease[t] += tasks[t].period;
+		if( (int32_t)( now - nextRelease[t] ) >= 0 )	// fell behind, don't try to catch up
+			nextRelease[t] = now + tasks[t].period;
+	}
+}
+
+void SCHED_Run( void )
+{
+	for(;;)
+	{
+		uint32_t now = HAL_GetTick(), start, time;
+		TASK_STATS *s;
+		uint8_t t;
+
+		Release( now );
+
+		for( t = 0; t < TASK_COUNT && !released[t]; ++t )
+			;
+
+		if( t == TASK_COUNT )
+		{
+			__WFI();
+			continue;
+		}
+
+		s = &stats[t];
+		time = now - releaseTime[t];
+		if( time > s->latency )
+			s->latency = time;
+		if( time > tasks[t].deadline )
+			s->missed++;
+
+		released[t] = 0;		// a signal from now on runs the task once more
+		start = DWT->CYCCNT;
+		tasks[t].run();
+		time = DWT->CYCCNT - start;
+
+		s->runs++;
+		s->total += time;
+		if( time > s->wcet )
+			s->wcet = time;
+	}
+}
+
+const TASK *SCHED_GetTask( uint8_t task )
+{
+	return ( tasks && task < TASK_COUNT ) ? &tasks[task] : NULL;
+}
+
+const TASK_STATS *SCHED_GetStats( uint8_t task )
+{
+	return ( task < TASK_COUNT ) ? &stats[task] : NULL;
+}
+
+void SCHED_ResetStats( void )
+{
+	uint8_t t;
+
+	for( t = 0; t < TASK_COUNT; ++t )
+		stats[t] = (TASK_STATS){ 0, };
+}
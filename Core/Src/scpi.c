@@ -17,122 +17,20 @@
 #include "rtc.h"
 #include "usart.h"
 #include "usbd_cdc_if.h"
+#include "usbd_usbtmc_if.h"
 #include "main.h"
 #include "gpio.h"
 #include "tft.h"
 #include "kbd.h"
 
 #include "dmm.h"
+#include "numfmt.h"
 #include "calib.h"
+#include "trig.h"
 #include "application.h"
-
-typedef enum {		// must be same order as above !
-	SCPI_IDN,
-	SCPI_RST,
-	SCPI_OPC,		// missing in original software !!
-	SCPI_SENS,
-	SCPI_CONF,
-	SCPI_CALC,
-	SCPI_SYST,
-	SCPI_AUTO,
-	SCPI_RANG,
-	SCPI_RATE,
-	SCPI_MEAS,
-	SCPI_FUNC,
-	SCPI_VOLT,
-	SCPI_CURR,
-	SCPI_FREQ,
-	SCPI_PER,
-	SCPI_CAP,
-	SCPI_CONT,
-	SCPI_DIOD,
-	SCPI_FRES,
-	SCPI_RES,
-	SCPI_TEMP,
-	SCPI_RTD,
-	SCPI_TYP,
-	SCPI_UNIT,
-	SCPI_SHOW,
-	SCPI_SCAL,
-	SCPI_THRE,
-	SCPI_AVER,
-	SCPI_ALL,
-	SCPI_MAX,
-	SCPI_MIN,
-	SCPI_DBM,
-	SCPI_DB,
-	SCPI_REF,
-	SCPI_NULL,
-	SCPI_OFFS,
-	SCPI_STAT,
-	SCPI_BEEP,
-	SCPI_DATE,
-	SCPI_TIME,
-	SCPI_LOC,
-	SCPI_REM,
-	SCPI_DEF,
-	SCPI_CAL,
-	SCPI_SEC,
-	SCPI_VAL,
-	SCPI_AC,
-	SCPI_DC,
-	SCPI_NONE,
-
-	SCPI_NUM_STRINGS
-} SCPI_STRINGS;
-
-const char * const scpi_keywords[] = {
-	"*IDN",
-	"*RST",
-	"*OPC",
-	"SENSe",
-	"CONFigure",
-	"CALCulate",
-	"SYSTem",
-	"AUTO",
-	"RANGe",
-	"RATE",
-	"MEAS",				// with ? only
-	"FUNCtion",
-	"VOLTage",
-	"CURRent",
-	"FREQuency",
-	"PERiod",
-	"CAPacitance",
-	"CONTinuity",
-	"DIODe",
-	"FourwireRESistance",
-	"RESistance",
-	"TEMPerature",
-	"RTD",
-	"TYPe",
-	"UNIT",
-	"SHOW",
-	"SCALe",
-	"THREshold",
-	"AVERage",
-	"ALL",
-	"MAXimum",
-	"MINimum",
-	"DBM",
-	"DB",
-	"REFerence",
-	"NULL",
-	"OFFSet",
-	"STATe",
-	"BEEPer",
-	"DATE",
-	"TIME",
-	"LOCal",
-	"REMote",
-	"DEFault",
-	"CALibrate",
-	"SECure",
-	"VALue",
-	"AC",
-	"DC",
-	"NONe"
-};
+#include "scpi.h"
+#include "scpikw.h"
+#include "sched.h"
 
 typedef struct _TRANSLATE {
 	int in;
@@ -181,10 +79,26 @@ static struct {
 } SCPI_StatusByte = { 0, };
 #endif
 
-static char cmd_buffer[100];
-static uint8_t buf_pos = 0;
-static uint8_t buf_ready = 1;
-static uint8_t buf_busy = 0;
+
+/*
+ * RS232 transport: the receiver runs as circular DMA into uart_rx, the idle line, half and full
+ * transfer events only publish the DMA write position. Lines are assembled in task context.
+ * There is no flow control: when the task falls behind by more than the ring, the DMA overwrites
+ * unread bytes. The byte counts detect that, the session drops the damaged line (UART_Lost()).
+ * Transmission goes through the uart_tx ring, drained by DMA one contiguous block at a time.
+ */
+#define UART_RX_SIZE		128		// power of 2
+#define UART_TX_SIZE		256		// power of 2
+
+static uint8_t uart_rx[UART_RX_SIZE];
+static volatile uint32_t uart_rx_received = 0;	// bytes received up to the last RX event, & UART_RX_SIZE-1: DMA write position
+static uint32_t uart_rx_read = 0;				// bytes assembled, & UART_RX_SIZE-1: next byte
+static volatile uint8_t uart_rx_lost = 0;		// unread bytes have been overwritten or the receiver was restarted
+
+static uint8_t uart_tx[UART_TX_SIZE];
+static uint16_t uart_tx_head = 0;			// next free byte, written by scpi_puts()
+static volatile uint16_t uart_tx_tail = 0;	// next byte to send, written by the DMA completion
+static volatile uint16_t uart_tx_len = 0;	// bytes in flight, 0: DMA idle
 
 int translate( TRANSLATE *table, int val, uint8_t reverse )
 {
@@ -204,17 +118,105 @@ int translate( TRANSLATE *table, int val, uint8_t reverse )
 	return table[x].out;
 }
 
-int scpi_printf( const char *fmt, ... )
+static void UART_Kick( void )		// start DMA on the next contiguous block, interrupt context or IRQs disabled
+{
+	uint16_t head = uart_tx_head, tail = uart_tx_tail;
+
+	if( uart_tx_len || head == tail )
+		return;
+
+	uart_tx_len = ( head > tail ) ? head - tail : UART_TX_SIZE - tail;
+	HAL_UART_Transmit_DMA( &huart1, &uart_tx[tail], uart_tx_len );
+}
+
+static uint16_t UART_Write( const uint8_t *buf, uint16_t len )	// never waits: drops what does not fit
+{
+	uint16_t n = 0;
+
+	while( n < len )
+	{
+		uint16_t next = ( uart_tx_head + 1 ) & ( UART_TX_SIZE - 1 );
+
+		if( next == uart_tx_tail )
+			break;
+
+		uart_tx[uart_tx_head] = buf[n++];
+		uart_tx_head = next;
+	}
+
+	__disable_irq();
+	UART_Kick();
+	__enable_irq();
+
+	return n;
+}
+
+static uint16_t UART_WriteFree( void )
+{
+	return ( uart_tx_tail - uart_tx_head - 1 ) & ( UART_TX_SIZE - 1 );
+}
+
+static uint32_t UART_Received( void )	// bytes received so far, also the ones no RX event has published yet
+{
+	uint32_t received = uart_rx_received;
+	uint32_t pos = UART_RX_SIZE - __HAL_DMA_GET_COUNTER( huart1.hdmarx );	// events come at least every UART_RX_SIZE / 2 bytes
+
+	return received + ( ( pos - received ) & ( UART_RX_SIZE - 1 ) );
+}
+
+static int UART_Getc( void )
+{
+	uint8_t c;
+
+	if( UART_Received() == uart_rx_read )
+		return -1;
+
+	c = uart_rx[ uart_rx_read & ( UART_RX_SIZE - 1 ) ];
+	if( UART_Received() - uart_rx_read > UART_RX_SIZE )		// overwritten, possibly while reading it
+	{
+		uart_rx_read = UART_Received();						// everything buffered is suspect
+		uart_rx_lost = 1;
+		return -1;
+	}
+
+	uart_rx_read++;
+	return c;
+}
+
+static uint8_t UART_Lost( void )
 {
-	va_list ap;
-	char txt[100];
-	va_start( ap, fmt );
+	if( !uart_rx_lost )
+		return 0;
 
-	int l = vsnprintf( txt, sizeof(txt)-1, fmt, ap );
-	HAL_UART_Transmit( &huart1, (uint8_t*)txt, l, 1000 );
+	uart_rx_lost = 0;
+	return 1;
+}
+
+static SCPI_SESSION sessions[] = {		// serviced round robin by Do_SCPI()
+	{ .name = "RS232",	.getc = UART_Getc,	.write = UART_Write,	.writeFree = UART_WriteFree,
+	  .lost = UART_Lost,	.echo = 1 },
+	{ .name = "USB",	.getc = CDC_Getc,	.write = CDC_Write,		.writeFree = CDC_WriteFree },
+	{ .name = "USBTMC",	.getc = TMC_Getc,	.write = TMC_Write,		.writeFree = TMC_WriteFree,
+	  .end = TMC_End,	.clear = TMC_Clear,	.status = TMC_Status },
+};
+
+#define NUM_SESSIONS	( sizeof(sessions) / sizeof(sessions[0]) )
 
-	va_end( ap );
-	return l;
+int scpi_puts( const char *txt )	// plain text to RS232, no formatting
+{
+	return UART_Write( (const uint8_t*)txt, strlen( txt ) );
+}
+
+static void ses_puts( SCPI_SESSION *ses, const char *txt )
+{
+	ses->write( (const uint8_t*)txt, strlen( txt ) );
+}
+
+static void ses_end( SCPI_SESSION *ses )	// terminate a response
+{
+	ses_puts( ses, "\n" );
+	if( ses->end )
+		ses->end();
 }
 
 static char *SCPI_Short( int kw )
@@ -236,57 +238,6 @@ static char *SCPI_Short( int kw )
 	return response;
 }
 
-int SCPI_Match( char *keyword )
-{
-	uint8_t i;
-
-	for( i = 0; i < SCPI_NUM_STRINGS; ++i )
-	{
-		const uint8_t *pattern;
-		uint8_t *cmd = (uint8_t*)keyword;
-
-		for( pattern = (const uint8_t*)scpi_keywords[i]; *pattern; ++pattern )
-		{
-			uint8_t ch = toupper( *cmd );
-
-			if( *pattern == ' ' )					// space in SCPI string must match one or more whitespace(s) in command string
-			{
-				if( !*cmd || !isspace( *cmd ) )		// no, command has no space there
-					break;
-
-				while( *cmd && isspace( *cmd ) )	// yes, command had space(s), skip them
-					++cmd;
-			}
-			else if( isupper( *pattern ) ||			// upper case SCPI character or star *MUST* match command character, ignoring it's case
-					*pattern == '*' )
-			{
-				if( ch != *pattern )				// no, command character does not match
-					break;
-				++cmd;								// yes, command character matches, advance
-			}
-			else if( toupper( *pattern ) == ch )	// lower case SCPI character *MAY* match command character, ignoring it's case
-			{
-				++cmd;								// yes, that matches, advance
-			}
-			else if( isalpha( ch ) )				// if command character is not a delimiter or number, it must match the NEXT upper case character of the SCPI string
-			{
-				const uint8_t *p = pattern;
-				while( *p && islower( *p ) )		// advance SCPI string to next upper case character - if any
-					++p;
-
-				if( ch != *p )						// no match either
-					break;
-				++cmd;								// yes, that matches, advance
-			}
-		}
-
-		if( !*pattern )								// bingo!
-			return i;
-	}
-
-	return -1;
-}
-
 #define MAX_SCPI_PATH 5
 #define MAX_SCPI_PARM 5
 
@@ -316,7 +267,397 @@ static void parse_value( char *str, double *val, char *unit, uint8_t unit_size )
 		*unit = 0;
 }
 
-char *scpi_show( int ch_index )
+static int parse_bool( char *str )	// ON|OFF|1|0 -> 1|0, -1 if neither
+{
+	switch( SCPI_Match( str ) )
+	{
+	case SCPI_ON:	return 1;
+	case SCPI_OFF:	return 0;
+	}
+
+	if( isdigit( (uint8_t)*str ) )
+		return atoi( str ) != 0;
+
+	return -1;
+}
+
+/*
+ * Operations lasting longer than a task run (calibration point, settling after a new scale) run as the job:
+ * the command starts it and returns, the acquisition completes it. There is one job at a time, as they all
+ * need the HY3131. Until it is done, Do_SCPI() holds back commands of any session which touch the measurement
+ * (overlapped commands), and *WAI / *OPC? of the session which started it.
+ */
+#define SCPI_SETTLE_READINGS	2		// complete readings after a new scale, the first one may still see the relays move
+#define SCPI_SETTLE_TIMEOUT		3000	// [ms]
+
+static struct {
+	SCPI_SESSION *owner;				// NULL: no job
+	uint8_t (*done)( void );
+	uint32_t start;						// HAL_GetTick() at the start
+	uint32_t readings;					// GetReadings() at the start
+} job = { NULL, };
+
+static uint8_t CalibDone( void )
+{
+	return !CALIB_Busy();
+}
+
+static uint8_t CaptureDone( void )
+{
+	return !TRIG_Busy();
+}
+
+static uint8_t SettleDone( void )
+{
+	return GetReadings() - job.readings >= SCPI_SETTLE_READINGS ||
+			HAL_GetTick() - job.start >= SCPI_SETTLE_TIMEOUT;
+}
+
+static void JobStart( SCPI_SESSION *ses, uint8_t (*done)( void ) )
+{
+	job.done = done;
+	job.start = HAL_GetTick();
+	job.readings = GetReadings();
+	job.owner = ses;
+}
+
+static void JobCheck( void )
+{
+	if( !job.owner || !job.done() )
+		return;
+
+	if( job.owner->opc )
+	{
+		job.owner->esr |= ESR_OPC;
+		job.owner->opc = 0;
+	}
+	job.owner = NULL;
+}
+
+static uint8_t StatusByte( SCPI_SESSION *ses )	// STB_xxx, MAV only known to the transport
+{
+	uint8_t stb = ( ses->esr & ses->ese ) ? STB_ESB : 0;
+
+	return ( stb & ses->sre ) ? stb | STB_MSS : stb;
+}
+
+static int FirstKeyword( const char *cmd, uint8_t *len )	// SCPI_xxx of the command's first keyword, its length
+{
+	char kw[12];
+	uint8_t n;
+
+	for( n = 0; n < sizeof(kw) - 1 && ( isalpha( (uint8_t)cmd[n] ) || cmd[n] == '*' ); ++n )
+		kw[n] = cmd[n];
+	kw[n] = 0;
+
+	if( len )
+		*len = n;
+	return SCPI_Match( kw );
+}
+
+static uint8_t JobWait( SCPI_SESSION *ses, const char *cmd )	// 1: cmd must wait for the job
+{
+	uint8_t n;
+
+	if( !job.owner )
+		return 0;
+
+	switch( FirstKeyword( cmd, &n ) )
+	{
+	case SCPI_WAI:	return job.owner == ses;
+	case SCPI_OPC:	return cmd[n] == '?' && job.owner == ses;
+	case SCPI_IDN:
+	case SCPI_ESR:
+	case SCPI_CLS:
+	case SCPI_ESE:
+	case SCPI_SRE:
+	case SCPI_STB:
+	case SCPI_TRG:
+	case SCPI_ABOR:
+	case SCPI_FETC:							// waits in Do_SCPI() for the capture only
+	case SCPI_SYST:
+	case SCPI_DISP:
+	case SCPI_FORM:	return 0;				// nothing to do with the measurement
+	default:		return 1;
+	}
+}
+
+/*
+ * Streaming (SYST:STR ON): every reading of channel 1 goes out as a SCPI_RECORD on the session which
+ * switched it on, four to a full 64 byte USB packet. Packets only go out whole, so text responses in
+ * between never split a record; a partly filled one is sent after STREAM_FLUSH_MS. On USBTMC every
+ * packet is a message of its own.
+ * While the transport can't take the packet, readings are lost and counted as overruns, their
+ * sequence numbers are skipped.
+ */
+#define STREAM_PACKET		64
+#define STREAM_FLUSH_MS		200
+
+static struct {
+	SCPI_SESSION *ses;					// NULL: off
+	uint8_t packet[STREAM_PACKET];
+	uint8_t len;						// bytes in packet
+	uint32_t since;						// HAL_GetTick() of its first record
+	uint16_t seq;
+	uint8_t flags;						// for the next record
+	uint32_t records;					// sent
+	uint32_t overruns;					// readings lost
+} stream = { NULL, };
+
+static uint8_t StreamFlush( void )		// 1: packet empty
+{
+	if( stream.len && stream.ses->writeFree() >= stream.len )
+	{
+		stream.ses->write( stream.packet, stream.len );
+		if( stream.ses->end )			// a message of its own
+			stream.ses->end();
+		stream.records += stream.len / sizeof(SCPI_RECORD);
+		stream.len = 0;
+	}
+
+	return !stream.len;
+}
+
+static void StreamStart( SCPI_SESSION *ses )
+{
+	if( stream.ses )
+		StreamFlush();
+
+	stream.len = 0;
+	stream.seq = 0;
+	stream.flags = SCPI_STREAM_FIRST;
+	stream.records = stream.overruns = 0;
+	stream.ses = ses;
+}
+
+static void StreamStop( void )
+{
+	StreamFlush();						// if it fits
+	stream.len = 0;
+	stream.ses = NULL;
+}
+
+void SCPI_Stream( double val )			// acquisition task, every reading of channel 1
+{
+	SCPI_RECORD *rec;
+	uint8_t *b, sum = 0;
+
+	if( !stream.ses )
+		return;
+
+	if( stream.len == STREAM_PACKET && !StreamFlush() )		// host not reading
+	{
+		stream.overruns++;
+		stream.seq++;
+		return;
+	}
+
+	if( !stream.len )
+		stream.since = HAL_GetTick();
+
+	rec = (SCPI_RECORD*)&stream.packet[stream.len];
+	rec->sync = SCPI_STREAM_SYNC;
+	rec->scale = DMM_GetScale( 1 );
+	rec->seq = stream.seq++;
+	rec->time = HAL_GetTick();
+	rec->value = val;
+	rec->overruns = stream.overruns;
+	rec->flags = stream.flags;
+	stream.flags = 0;
+
+	for( b = (uint8_t*)rec; b < &rec->check; ++b )
+		sum += *b;
+	rec->check = -sum;
+
+	stream.len += sizeof(SCPI_RECORD);
+	if( stream.len == STREAM_PACKET )
+		StreamFlush();
+}
+
+static void SessionClear( SCPI_SESSION *ses )	// device clear: input, output and commands in progress are gone
+{
+	uint8_t i;
+
+	for( i = 0; i < SCPI_QUEUE_SIZE; ++i )
+		ses->queue[i].len = ses->queue[i].done = 0;
+	ses->head = ses->count = 0;
+	ses->next = NULL;
+	ses->discard = 0;
+	ses->fetch = ses->fetched = 0;
+	ses->opc = 0;
+
+	if( stream.ses == ses )
+	{
+		stream.len = 0;
+		stream.ses = NULL;
+	}
+}
+
+static int scpi_scale( int *keyword, uint8_t idx, uint8_t num_kw, char *range )	// [:<scale>][:AC|DC] [<range>] -> SCALE_xxx, -1 if bad
+{
+	double val;
+	char unit[10];
+	int mode, scale;
+
+	mode = ( idx < num_kw ) ? translate( FUNC1_table, keyword[idx], 0 ) : -1;	// <scale> -> DmmXXX
+	if( mode < 0 ) mode = DmmDCVoltage;										// default to DmmDCVoltage, happens i.e. if no <scale> is present
+	else ++idx;
+
+	if( idx < num_kw && ( mode == DmmDCVoltage || mode == DmmDCCurrent ) )
+	{
+		if(		 keyword[idx] == SCPI_AC )
+			mode = ( mode == DmmDCVoltage ) ? DmmACVoltage : DmmACCurrent;
+		else if( keyword[idx] != SCPI_DC )	return -1;						// bad keyword
+	}
+
+	switch( mode )
+	{
+	case DmmTemperature:	return SCALE_TEMP;
+	case DmmFrequency:		return SCALE_FREQ;
+	case DmmDiode:			return SCALE_DIODE;
+	}
+
+	if( !range )															// none given: the largest
+	{
+		for( scale = DMM_CNTSCALES - 1; scale >= 0 && DMM_GetMode( scale ) != mode; --scale )
+			;
+		return scale;
+	}
+
+	parse_value( range, &val, unit, sizeof(unit) );
+	return DMM_FindScale( mode, val );										// -1: bad range
+}
+
+static const uint8_t formatSize[] = { 0, sizeof(float), sizeof(double), sizeof(int32_t) };	// by SCPI_FORMAT_xxx
+
+static uint8_t scpi_binary( char *buf, const void *val, uint8_t size, uint8_t swap )	// big endian, or as in memory (little endian) if swapped
+{
+	const uint8_t *b = val;
+	uint8_t i;
+
+	for( i = 0; i < size; ++i )
+		buf[i] = b[ swap ? i : size - 1 - i ];
+
+	return size;
+}
+
+/*
+ * FETC? / READ? response, as far as the transport takes it, 1 when complete.
+ * ASCii: comma separated readings, REAL / INTeger: one IEEE 488.2 definite length block "#<n><length><bytes>",
+ * INTeger preceded by the factor of its counts: "+1.000000e-07,#3400...".
+ */
+static uint8_t Fetch( SCPI_SESSION *ses )
+{
+	char buf[24];
+	uint8_t len = 0;
+
+	if( TRIG_Busy() )							// capture still running
+		return 0;
+
+	if( ses->fetch == 1 )						// header
+	{
+		if( ses->format != SCPI_FORMAT_ASCII )
+		{
+			char bytes[6];
+
+			if( ses->writeFree() < sizeof(buf) )
+				return 0;
+
+			if( ses->format == SCPI_FORMAT_INT32 )
+			{
+				len = NUM_Exp( buf, TRIG_GetFactor(), 6, NUM_SIGN );
+				buf[len++] = ',';
+			}
+
+			sprintf( bytes, "%u", (unsigned)( TRIG_Readings() * formatSize[ses->format] ) );
+			len += sprintf( buf + len, "#%u%s", (unsigned)strlen( bytes ), bytes );
+			ses->write( (const uint8_t*)buf, len );
+		}
+		ses->fetch = 2;
+	}
+
+	for( ; ses->fetched < TRIG_Readings(); ses->fetched++ )
+	{
+		if( ses->writeFree() < sizeof(buf) )
+			return 0;
+
+		switch( ses->format )
+		{
+		case SCPI_FORMAT_ASCII:
+			len = 0;
+			if( ses->fetched )
+				buf[len++] = ',';
+			len += NUM_Exp( buf + len, TRIG_GetReading( ses->fetched ), 6, NUM_SIGN );
+			break;
+
+		case SCPI_FORMAT_REAL32:
+			{
+				float f = TRIG_GetReading( ses->fetched );
+				len = scpi_binary( buf, &f, sizeof(f), ses->swap );
+			}
+			break;
+
+		case SCPI_FORMAT_REAL64:
+			{
+				double d = TRIG_GetReading( ses->fetched );
+				len = scpi_binary( buf, &d, sizeof(d), ses->swap );
+			}
+			break;
+
+		case SCPI_FORMAT_INT32:
+			{
+				int32_t i = TRIG_GetRaw( ses->fetched );
+				len = scpi_binary( buf, &i, sizeof(i), ses->swap );
+			}
+			break;
+		}
+		ses->write( (const uint8_t*)buf, len );
+	}
+
+	if( !ses->writeFree() )
+		return 0;
+
+	ses_end( ses );
+	ses->fetch = ses->fetched = 0;
+	return 1;
+}
+
+static uint8_t FetchBypass( SCPI_SESSION *ses )	// 1: the next command runs while FETC? / READ? waits for the capture
+{
+	const char *cmd;
+
+	if( !TRIG_Busy() || !ses->count )			// waiting for the transport, or nothing queued
+		return 0;
+
+	for( cmd = ses->next ? ses->next : ses->queue[ses->head].text; isspace( (uint8_t)*cmd ); ++cmd )
+		;
+	if( *cmd == ':' )
+		++cmd;
+
+	switch( FirstKeyword( cmd, NULL ) )
+	{
+	case SCPI_TRG:								// the BUS trigger the capture waits for
+	case SCPI_ABOR:								// ends it, the readings so far go out
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+static char *NoReadings( SCPI_SESSION *ses )	// FETC? / READ? response without readings, as Fetch() gives it
+{
+	uint8_t len = 0;
+
+	if( ses->format == SCPI_FORMAT_INT32 )
+	{
+		len = NUM_Exp( ses->out, TRIG_GetFactor(), 6, NUM_SIGN );
+		ses->out[len++] = ',';
+	}
+	strcpy( ses->out + len, ( ses->format == SCPI_FORMAT_ASCII ) ? "" : "#10" );
+	return ses->out;
+}
+
+char *scpi_show( SCPI_SESSION *ses, int ch_index )
 {
 	int scale = DMM_GetScale( ch_index );
 	if( scale < 0 ) return "NONE";
@@ -330,319 +671,675 @@ char *scpi_show( int ch_index )
 	default: s = SCPI_Short( translate( FUNC1_table, mode, 1 ) ); break;		// DmmXXX -> SCPI_XXX scale
 	}
 
-	sprintf( cmd_buffer, "%s %+1.4e\n", s, dmmcfg[scale].range );
-	return cmd_buffer;
+	char *p = ses->out + strlen( strcpy( ses->out, s ) );		// "%s %+1.4e\n"
+	*p++ = ' ';
+	p += NUM_Exp( p, dmmcfg[scale].range, 4, NUM_SIGN );
+	*p++ = '\n';
+	*p = 0;
+	return ses->out;
 }
 
-char *SCPI_Execute( char *command_string )
+char *SCPI_Execute( SCPI_SESSION *ses, char *command_string )
 {
 	RTC_TimeTypeDef sTime;
 	RTC_DateTypeDef sDate;
 
 	int keyword[MAX_SCPI_PATH];
-	int ch_index;
+	int ch_index = -1;
 	char *parameter[MAX_SCPI_PARM];
 	uint8_t num_kw, idx, num_parm;
 	char *p, *kw, delimiter = 0;
-	char *cmd, *sep1 = command_string;
+	char *cmd = command_string;
 	char *parm, *sep2;
 	double val;
 	char unit[10];
-	int s, scale, mode;
+	int s, scale;
 
-	while( ( cmd = strsep( &sep1, ";" ) ) != NULL )		// multiple commands can be chained
+	// traverse SCPI path
+	for( num_kw = 0; num_kw < MAX_SCPI_PATH && *cmd; )
 	{
-		ch_index = -1;
+		for( kw = p = cmd; isalpha( (uint8_t)*p ) || *p == '*'; ++p )
+			;
 
-		// traverse SCPI path
-		for( num_kw = 0; num_kw < MAX_SCPI_PATH && *cmd; )
+		if( isdigit( (uint8_t)*p ) )
 		{
-			for( kw = p = cmd; isalpha( (uint8_t)*p ) || *p == '*'; ++p )
+			if( ch_index != -1 ) return NULL;		// channel index already on a previous keyword
+			ch_index = atoi( p );					// TODO: check index
+			for( *p = 0; isdigit( (uint8_t)*++p ); )
 				;
+		}
 
-			if( isdigit( (uint8_t)*p ) )
-			{
-				if( ch_index != -1 ) return NULL;		// channel index already on a previous keyword
-				ch_index = atoi( p );					// TODO: check index
-				for( *p = 0; isdigit( (uint8_t)*++p ); )
-					;
-			}
-
-			if( ( delimiter = *p ) != 0 )
-				*p++ = 0;
-			cmd = p;
+		if( ( delimiter = *p ) != 0 )
+			*p++ = 0;
+		cmd = p;
 
-			keyword[num_kw++] = SCPI_Match( kw );
+		keyword[num_kw++] = SCPI_Match( kw );
 
-			if( delimiter != ':' )						// more to come ?
-				break;
-		}
+		if( delimiter != ':' )						// more to come ?
+			break;
+	}
 
-		if( ch_index == -1 ) ch_index = 1;
+	if( ch_index == -1 ) ch_index = 1;
 
-		num_parm = 0;
-		if( isspace( (uint8_t)delimiter ) )				// command with parameters
-		{
-			while( *cmd && isspace( (uint8_t)*cmd ) )
-				++cmd;
+	num_parm = 0;
+	if( isspace( (uint8_t)delimiter ) ||			// command with parameters
+		( delimiter == '?' && isspace( (uint8_t)*cmd ) ) )		// query with parameters
+	{
+		while( *cmd && isspace( (uint8_t)*cmd ) )
+			++cmd;
 
-			sep2 = cmd;
-			while( num_parm < MAX_SCPI_PARM && ( parm = strsep( &sep2, "," ) ) != NULL )
-				parameter[ num_parm++ ] = parm;
-		}
-		else if( delimiter != '?' )						// not a query -> command without parameters
-			*cmd = 0;
+		sep2 = cmd;
+		while( num_parm < MAX_SCPI_PARM && ( parm = strsep( &sep2, "," ) ) != NULL )
+			parameter[ num_parm++ ] = parm;
+	}
+	else if( delimiter != '?' )						// not a query -> command without parameters
+		*cmd = 0;
 
-		if( num_kw == 0 ) return NULL;					// nothing to do
+	if( num_kw == 0 ) return NULL;					// nothing to do
 
 #if 1
+	if( ses->echo )
+	{
 		for( s = 0; s < num_kw; ++s )
 		{
-			if( s ) scpi_printf( ":" );
-			scpi_printf( SCPI_Short( keyword[s] ) );
+			if( s ) ses_puts( ses, ":" );
+			ses_puts( ses, SCPI_Short( keyword[s] ) );
 		}
 
-		if( delimiter ) scpi_printf( "%c", delimiter );
-		scpi_printf( " " );
+		if( delimiter )
+		{
+			char d[2] = { delimiter, 0 };
+			ses_puts( ses, d );
+		}
+		ses_puts( ses, " " );
 
 		for( s = 0; s < num_parm; ++s )
 		{
-			if( s ) scpi_printf( "," );
-			scpi_printf( parameter[s] );
+			if( s ) ses_puts( ses, "," );
+			ses_puts( ses, parameter[s] );
 		}
-		scpi_printf( "\n" );
+		ses_puts( ses, "\n" );
+	}
 #endif
 
-		idx = 0;
-		if( keyword[idx] == SCPI_SENS )				// a leading SENS is optional
+	idx = 0;
+	if( keyword[idx] == SCPI_SENS )				// a leading SENS is optional
+	{
+		if( ++idx == num_kw )						// but nothing else follows?
+			return NULL;
+	}
+
+	switch( keyword[idx++] )
+	{
+	case SCPI_IDN:			// IEEE mandatory command
+		if( delimiter == '?' )
 		{
-			if( ++idx == num_kw )						// but nothing else follows?
-				return NULL;
+			if( *MANUFACTURER == 0xFF || *MODEL == 0xFF || *SERIALNO == 0xFF )	// missing calibration data (empty FLASH area @ 0x0801F800)!
+				snprintf( ses->out, sizeof(ses->out)-1, "A-Z-E,Phoenix DMM,00001,%s", VER_SHORT );
+			else
+				snprintf( ses->out, sizeof(ses->out)-1, "%s,%s,%s,%s", MANUFACTURER, MODEL, SERIALNO, VER_SHORT );
+			return ses->out;
 		}
+		break;
 
-		switch( keyword[idx++] )
+	case SCPI_RST:			// IEEE mandatory command
+		if( delimiter == '?' )
 		{
-		case SCPI_IDN:			// IEEE mandatory command
+			DMM_Init();
+			RedrawScreen();
+			SetScale( 1, SCALE_DC_1kV );
+			SetAuto( 1 );
+
+			TRIG_Abort();
+			TRIG_SetSource( TRIG_IMMEDIATE );
+			TRIG_SetDelay( 0 );
+			TRIG_SetCount( 1 );
+		}
+		break;
+
+	case SCPI_OPC:			// IEEE mandatory command: *OPC? answers when the job of this session is done, *OPC sets ESR_OPC then
+		if( delimiter == '?' )
+			return "1";									// held back by Do_SCPI() until now
+		if( job.owner == ses )
+			ses->opc = 1;
+		else
+			ses->esr |= ESR_OPC;
+		break;
+
+	case SCPI_WAI:			// IEEE mandatory command, held back by Do_SCPI() until the job of this session is done
+		break;
+
+	case SCPI_ESR:			// IEEE mandatory command, reading clears it
+		if( delimiter == '?' )
+		{
+			sprintf( ses->out, "%u", ses->esr );
+			ses->esr = 0;
+			return ses->out;
+		}
+		break;
+
+	case SCPI_CLS:			// IEEE mandatory command
+		ses->esr = 0;
+		ses->opc = 0;
+		break;
+
+	case SCPI_ESE:			// IEEE mandatory command, ESR bits setting ESB in the status byte
+	case SCPI_SRE:			// IEEE mandatory command, status byte bits requesting service (USBTMC SRQ)
+		{
+			uint8_t *reg = ( keyword[idx-1] == SCPI_ESE ) ? &ses->ese : &ses->sre;
+
 			if( delimiter == '?' )
 			{
-				if( *MANUFACTURER == 0xFF || *MODEL == 0xFF || *SERIALNO == 0xFF )	// missing calibration data (empty FLASH area @ 0x0801F800)!
-					snprintf( cmd_buffer, sizeof(cmd_buffer)-1, "A-Z-E,Phoenix DMM,00001,%s", VER_SHORT );
-				else
-					snprintf( cmd_buffer, sizeof(cmd_buffer)-1, "%s,%s,%s,%s", MANUFACTURER, MODEL, SERIALNO, VER_SHORT );
-				return cmd_buffer;
+				sprintf( ses->out, "%u", *reg );
+				return ses->out;
 			}
-			break;
+			if( num_parm == 0 ) return NULL;
+			s = atoi( parameter[0] );
+			if( s < 0 || s > 255 ) return NULL;
+			*reg = ( reg == &ses->sre ) ? s & ~STB_MSS : s;
+		}
+		break;
+
+	case SCPI_STB:			// IEEE mandatory command
+		if( delimiter == '?' )
+		{
+			sprintf( ses->out, "%u", StatusByte( ses ) );
+			return ses->out;
+		}
+		break;
+
+	case SCPI_CONF:			// CONF[:SCAL][:<scale>][:AC|DC]{?| <range>}		// SCAL isoptional, if <scale> and/or <AC|DC> are missing, default to DCV
+		if( delimiter == '?' ) return scpi_show( ses, ch_index );					// query? -> show current scale/range
+		if( num_parm == 0 ) return NULL;										// else a range parameter must be given
 
-		case SCPI_RST:			// IEEE mandatory command
+		if( keyword[idx] == SCPI_SCAL && ++idx == num_kw ) return NULL;			// skip SCAL keyword, if present
+
+		scale = scpi_scale( keyword, idx, num_kw, parameter[0] );
+		if( scale < 0 ) return NULL;											// bad function or range
+		SetScale( 1, scale );
+		JobStart( ses, SettleDone );
+		break;
+
+	case SCPI_MEAS:			// MEAS[:<scale>][:AC|DC]? [<range>] - CONF and READ?, with one reading triggered at once
+		if( delimiter != '?' ) return NULL;
+
+		scale = scpi_scale( keyword, idx, num_kw, num_parm ? parameter[0] : NULL );
+		if( scale < 0 ) return NULL;
+		SetScale( 1, scale );
+
+		TRIG_SetSource( TRIG_IMMEDIATE );
+		TRIG_SetCount( 1 );
+		TRIG_Initiate( 1 );								// the first reading on the new scale may still see the relays move
+		JobStart( ses, CaptureDone );
+		ses->fetch = 1;
+		break;
+
+	case SCPI_READ:			// READ? - INIT and FETC?
+		if( delimiter != '?' ) return NULL;
+		if( TRIG_GetSource() == TRIG_BUS )				// its *TRG could only come after the response: answered empty
+		{
+			ses->esr |= ESR_EXE;
+			return NoReadings( ses );
+		}
+		TRIG_Initiate( 0 );
+		JobStart( ses, CaptureDone );
+		ses->fetch = 1;
+		break;
+
+	case SCPI_INIT:			// INIT[:IMM] - arm the trigger, TRIG:COUN readings go into the buffer
+		TRIG_Initiate( 0 );
+		JobStart( ses, CaptureDone );
+		break;
+
+	case SCPI_FETC:			// FETC? - the buffer, once complete; always answered, an empty buffer gives an empty line / "#10"
+		if( delimiter == '?' )
+			ses->fetch = 1;
+		break;
+
+	case SCPI_TRG:			// IEEE mandatory command, the BUS trigger
+		TRIG_Bus();
+		break;
+
+	case SCPI_ABOR:			// ABOR - back to idle, FETC? gets the readings taken so far
+		TRIG_Abort();
+		break;
+
+	case SCPI_TRIG:			// TRIG:SOUR IMM|BUS | TRIG:DEL <s>
+		switch( keyword[idx] )
+		{
+		case SCPI_SOUR:
 			if( delimiter == '?' )
+				return SCPI_Short( TRIG_GetSource() == TRIG_BUS ? SCPI_BUS : SCPI_IMM );
+			if( num_parm )
 			{
-				DMM_Init();
-				TFT_setForeGround( BACKGROUND_COLOR );
-				TFT_fillRect( 0, 0, TFT_WIDTH-1, TFT_HEIGHT-1 );		// Clear screen
-				SetScale( 1, SCALE_DC_1kV );
-				SetAuto( 1 );
+				switch( SCPI_Match( parameter[0] ) )
+				{
+				case SCPI_IMM:	TRIG_SetSource( TRIG_IMMEDIATE ); break;
+				case SCPI_BUS:	TRIG_SetSource( TRIG_BUS ); break;
+				}
 			}
 			break;
 
-		case SCPI_OPC:			// IEEE mandatory command
+		case SCPI_DEL:
 			if( delimiter == '?' )
 			{
-				int state = DMM_Ready( ch_index );
-				if( state >= 0 ) return state ? "1" : "0";
+				NUM_Exp( ses->out, TRIG_GetDelay() / 1000.0, 4, NUM_SIGN );
+				return ses->out;
+			}
+			if( num_parm )
+			{
+				parse_value( parameter[0], &val, unit, sizeof(unit) );
+				if( val >= 0 && val <= 60 )
+					TRIG_SetDelay( val * 1000 + 0.5 );
 			}
 			break;
+		}
+		break;
 
-		case SCPI_CONF:			// CONF[:SCAL][:<scale>][:AC|DC]{?| <range>}		// SCAL isoptional, if <scale> and/or <AC|DC> are missing, default to DCV
-			if( delimiter == '?' ) return scpi_show( ch_index );					// query? -> show current scale/range
-			if( num_parm == 0 ) return NULL;										// else a range parameter must be given
-
-			if( keyword[idx] == SCPI_SCAL && ++idx == num_kw ) return NULL;			// skip SCAL keyword, if present
-
-			mode = translate( FUNC1_table, keyword[idx], 0 );						// <scale> -> DmmXXX
-			if( mode < 0 ) mode = DmmDCVoltage;										// default to DmmDCVoltage, happens i.e. if no <scale> is present
-			else ++idx;
-
-			if( idx < num_kw && ( mode == DmmDCVoltage || mode == DmmDCCurrent ) )
+	case SCPI_FORM:			// FORM:DATA ASC|REAL[,32|64]|INT[,32] | FORM:BORD NORM|SWAP - FETC? / READ? / MEAS? responses of this session
+		switch( keyword[idx] )
+		{
+		case SCPI_DATA:
+			if( delimiter == '?' )
 			{
-				if(		 keyword[idx] == SCPI_AC )
+				switch( ses->format )
 				{
-					if(		 mode == DmmDCVoltage )	mode = DmmACVoltage;
-					else if( mode == DmmDCCurrent )	mode = DmmACCurrent;
-					else							return NULL;					// bad AC parameter
+				case SCPI_FORMAT_REAL32:	return "REAL,32";
+				case SCPI_FORMAT_REAL64:	return "REAL,64";
+				case SCPI_FORMAT_INT32:		return "INT,32";
+				default:					return "ASC";
 				}
-				else if( keyword[idx] != SCPI_DC )	return NULL;					// bad keyword
 			}
+			if( num_parm == 0 ) return NULL;
 
-			parse_value( parameter[0], &val, unit, sizeof(unit) );
-
-			switch( mode )
+			s = ( num_parm > 1 ) ? atoi( parameter[1] ) : 0;		// length, 0: default
+			switch( SCPI_Match( parameter[0] ) )
 			{
-			case DmmTemperature:	SetScale( 1, SCALE_TEMP ); break;
-			case DmmFrequency:		SetScale( 1, SCALE_FREQ ); break;
-			case DmmDiode:			SetScale( 1, SCALE_DIODE ); break;
-
-			default:
-				scale = DMM_FindScale( mode, val );
-				if( scale < 0 ) return NULL;										// bad range
-				SetScale( 1, scale );
+			case SCPI_ASC:
+				ses->format = SCPI_FORMAT_ASCII;
+				break;
+
+			case SCPI_REAL:
+				if(		 s == 32 )			ses->format = SCPI_FORMAT_REAL32;
+				else if( s == 64 || !s )	ses->format = SCPI_FORMAT_REAL64;
+				else						return NULL;				// bad length
+				break;
+
+			case SCPI_INT:
+				if( s && s != 32 ) return NULL;
+				ses->format = SCPI_FORMAT_INT32;
 				break;
 			}
 			break;
 
-		case SCPI_FUNC:		// [SENS:]FUNC[1|2] [<function>]
-			if( ch_index > 2 ) return NULL;											// bad index
-			if( delimiter == '?' ) return scpi_show( ch_index );
+		case SCPI_BORD:
+			if( delimiter == '?' )
+				return ses->swap ? "SWAP" : "NORM";
 			if( num_parm )
 			{
-				s = SCPI_Match( parameter[0] );
-				s = translate( ch_index == 2 ? FUNC2_table : FUNC1_table, s, 0 );
-				if( s < 0 ) return "bad scale";
-				SetScale( ch_index, s );
+				switch( SCPI_Match( parameter[0] ) )
+				{
+				case SCPI_NORM:	ses->swap = 0; break;
+				case SCPI_SWAP:	ses->swap = 1; break;
+				}
 			}
 			break;
+		}
+		break;
 
-		case SCPI_TEMP:
+	case SCPI_SAMP:			// SAMP:COUN <n>
+		if( keyword[idx] != SCPI_COUN )
 			break;
+		if( delimiter == '?' )
+		{
+			sprintf( ses->out, "%u", TRIG_GetCount() );
+			return ses->out;
+		}
+		if( num_parm )
+		{
+			s = atoi( parameter[0] );
+			if( s < 1 || s > TRIG_SAMPLES_MAX ) return NULL;		// out of range
+			TRIG_SetCount( s );
+		}
+		break;
+
+	case SCPI_FUNC:		// [SENS:]FUNC[1|2] [<function>]
+		if( ch_index > 2 ) return NULL;											// bad index
+		if( delimiter == '?' ) return scpi_show( ses, ch_index );
+		if( num_parm )
+		{
+			s = SCPI_Match( parameter[0] );
+			s = translate( ch_index == 2 ? FUNC2_table : FUNC1_table, s, 0 );
+			if( s < 0 ) return "bad scale";
+			SetScale( ch_index, s );
+			JobStart( ses, SettleDone );
+		}
+		break;
 
-		case SCPI_SYST:
-			switch( keyword[idx] )
+	case SCPI_TEMP:
+		break;
+
+	case SCPI_SYST:
+		switch( keyword[idx] )
+		{
+		case SCPI_DATE:
+		case SCPI_TIME:
 			{
-			case SCPI_DATE:
-			case SCPI_TIME:
+				HAL_RTC_GetTime( &hrtc, &sTime, RTC_FORMAT_BIN );	// MUST read both time and date, and in this order !
+				HAL_RTC_GetDate( &hrtc, &sDate, RTC_FORMAT_BIN );
+
+				if( delimiter == '?' )
 				{
-					HAL_RTC_GetTime( &hrtc, &sTime, RTC_FORMAT_BIN );	// MUST read both time and date, and in this order !
-					HAL_RTC_GetDate( &hrtc, &sDate, RTC_FORMAT_BIN );
+					if( keyword[idx] == SCPI_DATE )
+						sprintf( ses->out, "%d,%d,%d\n", sDate.Year + 1980, sDate.Month, sDate.Date );
+					else
+						sprintf( ses->out, "%d,%d,%d\n", sTime.Hours, sTime.Minutes, sTime.Seconds );
+					return ses->out;
+				}
+
+				if( num_parm == 3 )
+				{
+					uint16_t i, val[3];
+
+					for( i = 0; i < 3; ++i )
+						val[i] = atoi( parameter[i] );
 
-					if( delimiter == '?' )
+					if( keyword[idx] == SCPI_DATE )		// year,month,day
 					{
-						if( keyword[idx] == SCPI_DATE )
-							sprintf( cmd_buffer, "%d,%d,%d\n", sDate.Year + 1980, sDate.Month, sDate.Date );
-						else
-							sprintf( cmd_buffer, "%d,%d,%d\n", sTime.Hours, sTime.Minutes, sTime.Seconds );
-						return cmd_buffer;
+						sDate.Year = val[0] - ( ( val[0] >= 2000 ) ? 2000 : 0 );
+						sDate.Month = val[1];
+						sDate.Date = val[2];
+						sDate.WeekDay = RTC_WEEKDAY_MONDAY;
 					}
-
-					if( num_parm == 3 )
+					else								// hour, minute, second
 					{
-						uint16_t i, val[3];
-
-						for( i = 0; i < 3; ++i )
-							val[i] = atoi( parameter[i] );
-
-						if( keyword[idx] == SCPI_DATE )		// year,month,day
-						{
-							sDate.Year = val[0] - ( ( val[0] >= 2000 ) ? 2000 : 0 );
-							sDate.Month = val[1];
-							sDate.Date = val[2];
-							sDate.WeekDay = RTC_WEEKDAY_MONDAY;
-						}
-						else								// hour, minute, second
-						{
-							sTime.Hours = val[0];
-							sTime.Minutes = val[1];
-							sTime.Seconds = val[2];
-						}
-
-						HAL_RTC_SetTime( &hrtc, &sTime, RTC_FORMAT_BIN );
-						HAL_RTC_SetDate( &hrtc, &sDate, RTC_FORMAT_BIN );
+						sTime.Hours = val[0];
+						sTime.Minutes = val[1];
+						sTime.Seconds = val[2];
 					}
+
+					HAL_RTC_SetTime( &hrtc, &sTime, RTC_FORMAT_BIN );
+					HAL_RTC_SetDate( &hrtc, &sDate, RTC_FORMAT_BIN );
+					ClockChanged();
 				}
-				break;
 			}
 			break;
 
-		case SCPI_CAL:
-			switch( keyword[idx] )
-			{
-			case SCPI_SEC:	break;		// no password needed
+		case SCPI_REM:		// SYST:REM - front panel off, all cycles to acquisition and SCPI
+			SetRemote( 1 );
+			break;
 
-			case SCPI_VAL:
-				if( num_parm == 0 )
-					break;
+		case SCPI_LOC:		// SYST:LOC - back to the front panel
+			SetRemote( 0 );
+			break;
 
-				parse_value( parameter[0], &val, unit, sizeof(unit) );
-				s = val;
+		case SCPI_TASK:		// SYST:TASK? (task names) | SYST:TASK? <n> (runs,missed,avg us,wcet us,max latency ms) | SYST:TASK (reset)
+			if( delimiter == '?' )
+			{
+				const TASK *t;
+				const TASK_STATS *ts;
+				uint8_t n;
 
-				if( s > 1 )
+				if( !num_parm )
 				{
-					if( num_parm < 2 ) break;
-					parse_value( parameter[1], &val, unit, sizeof(unit) );
+					for( ses->out[0] = 0, n = 0; ( t = SCHED_GetTask( n ) ) != NULL; ++n )
+					{
+						if( n )
+							strcat( ses->out, "," );
+						strcat( ses->out, t->name );
+					}
+					return ses->out;
 				}
 
-				switch( s )
-				{
-				case 0:	CALIB_CalibOnZero( NULL ); break;				// zero
-				case 1:	CALIB_CalibOnPositive( val, NULL ); break;		// positive
-				case 2: CALIB_CalibOnNegative( val, NULL ); break;		// negative (DC and TEMP only)
-				}
-				break;
+				n = atoi( parameter[0] );
+				if( ( ts = SCHED_GetStats( n ) ) == NULL )
+					break;
+
+				sprintf( ses->out, "%lu,%lu,%lu,%lu,%lu",
+						(unsigned long)ts->runs, (unsigned long)ts->missed,
+						(unsigned long)( ts->runs ? ts->total / ts->runs / ( SystemCoreClock / 1000000 ) : 0 ),
+						(unsigned long)( ts->wcet / ( SystemCoreClock / 1000000 ) ), (unsigned long)ts->latency );
+				return ses->out;
+			}
+			SCHED_ResetStats();
+			break;
+
+		case SCPI_STR:		// SYST:STR ON|OFF | SYST:STR? (on,records,overruns)
+			if( delimiter == '?' )
+			{
+				sprintf( ses->out, "%u,%lu,%lu", stream.ses == ses,
+						(unsigned long)stream.records, (unsigned long)stream.overruns );
+				return ses->out;
 			}
+			if( num_parm && ( s = parse_bool( parameter[0] ) ) >= 0 )
+			{
+				if( s )
+					StreamStart( ses );
+				else if( stream.ses == ses )
+					StreamStop();
+			}
+			break;
+		}
+		break;
+
+	case SCPI_DISP:		// DISP:RATE <Hz> | DISP:FILT ON|OFF | DISP:FRAM? (frames,dropped,last us,max us,budget us,over budget) | DISP:FRAM (reset)
+		switch( keyword[idx] )
+		{
+		case SCPI_RATE:
+			if( delimiter == '?' )
+			{
+				sprintf( ses->out, "%d", GetFrameRate() );
+				return ses->out;
+			}
+			if( num_parm )
+				SetFrameRate( atoi( parameter[0] ) );
 			break;
 
+		case SCPI_FILT:
+			if( delimiter == '?' )
+				return GetDisplayFilter() ? "1" : "0";
+			if( num_parm && ( s = parse_bool( parameter[0] ) ) >= 0 )
+				SetDisplayFilter( s );
+			break;
+
+		case SCPI_FRAM:
+			if( delimiter == '?' )
+			{
+				const FRAME_STATS *fs = GetFrameStats();
+				sprintf( ses->out, "%lu,%lu,%lu,%lu,%lu,%lu",
+						(unsigned long)fs->frames, (unsigned long)fs->dropped, (unsigned long)fs->last,
+						(unsigned long)fs->max, (unsigned long)fs->budget, (unsigned long)fs->overBudget );
+				return ses->out;
+			}
+			ResetFrameStats();
+			break;
 		}
+		break;
+
+	case SCPI_CAL:
+		switch( keyword[idx] )
+		{
+		case SCPI_SEC:	break;		// no password needed
+
+		case SCPI_VAL:
+			if( num_parm == 0 )
+				break;
+
+			parse_value( parameter[0], &val, unit, sizeof(unit) );
+			s = val;
+
+			if( s > 1 )
+			{
+				if( num_parm < 2 ) break;
+				parse_value( parameter[1], &val, unit, sizeof(unit) );
+			}
+
+			switch( s )
+			{
+			case 0:	s = CALIB_ZERO; break;
+			case 1:	s = CALIB_POSITIVE; break;
+			case 2: s = CALIB_NEGATIVE; break;				// DC and TEMP only
+			default: return NULL;
+			}
+
+			if( CALIB_Start( s, val ) == ERRVAL_CMD_BUSY )	// the acquisition task takes the readings
+				JobStart( ses, CalibDone );
+			break;
+		}
+		break;
+
 	}
 
 	return NULL;
 }
 
-void HAL_UART_RxCpltCallback( UART_HandleTypeDef *huart )
+void HAL_UARTEx_RxEventCallback( UART_HandleTypeDef *huart, uint16_t Size )
+{
+	if( huart != &huart1 )
+		return;
+
+	uart_rx_received += ( Size - uart_rx_received ) & ( UART_RX_SIZE - 1 );		// Size == UART_RX_SIZE at the wrap
+	SCHED_Signal( TASK_SCPI );
+}
+
+void HAL_UART_TxCpltCallback( UART_HandleTypeDef *huart )
 {
 	if( huart != &huart1 )
 		return;
 
-	// a character has been received into cmd_buffer[buf_pos]
+	uart_tx_tail = ( uart_tx_tail + uart_tx_len ) & ( UART_TX_SIZE - 1 );
+	uart_tx_len = 0;
+	UART_Kick();
+}
 
-	if( buf_busy == 2 || buf_ready ) return;	// USB CDC is already receiving, or last command not yet processed
+static void UART_StartRx( void )
+{
+	uart_rx_received = uart_rx_read = 0;
+	HAL_UARTEx_ReceiveToIdle_DMA( &huart1, uart_rx, UART_RX_SIZE );
+}
 
-	buf_busy = 1;
-	if( cmd_buffer[buf_pos] == '\n' )		// message complete
+void HAL_UART_ErrorCallback( UART_HandleTypeDef *huart )
+{
+	if( huart != &huart1 )
+		return;
+
+	if( huart->RxState == HAL_UART_STATE_READY )	// reception aborted (overrun, framing error)
 	{
-		cmd_buffer[buf_pos] = 0;
-		buf_ready = 1;
+		uart_rx_lost = 1;
+		UART_StartRx();
 	}
-	else
-	{
-		if( cmd_buffer[buf_pos] != '\r' )	// overwrite CR
-			++buf_pos;
+}
 
-		// start receiving next character
-		HAL_UART_Receive_IT( &huart1, (uint8_t*)&cmd_buffer[buf_pos], 1 );
+static void LineFeed( SCPI_LINE *line, char c )
+{
+	if( c == '\n' )						// message complete
+	{
+		line->text[line->len] = 0;
+		line->done = 1;
 	}
+	else if( c == SCPI_CANCEL )			// the transport aborted the message
+		line->len = 0;
+	else if( c != '\r' && line->len < sizeof(line->text) - 1 )		// too long: truncate
+		line->text[line->len++] = c;
 }
 
-void SCPI_CDC_RxCallback( uint8_t *Buf, uint16_t Len )
+void SCPI_Init( void )
 {
-	if( buf_busy == 2 || buf_ready ) return;	// RS232 is already receiving, or last command not yet processed
+	UART_StartRx();
+}
 
-	buf_busy = 2;
-	if( Len >= sizeof(cmd_buffer) - 1 )
-		Len = sizeof(cmd_buffer) - 2;
-	strncpy( cmd_buffer, (char*)Buf, Len );
-	cmd_buffer[Len] = 0;
-	buf_ready = 2;
+void SCPI_RxCallback( void )		// USB interrupt, bytes have been queued for a session's getc(), or a device clear
+{
+	SCHED_Signal( TASK_SCPI );
 }
 
-void Do_SCPI( void )
+void Do_SCPI( void )		// at most one command per session and call, round robin
 {
-	if( !buf_ready ) return;
+	static uint8_t first = 0;
+	uint8_t i, more = 0;
 
-	if( buf_pos > 0 )
+	JobCheck();
+
+	if( stream.len && HAL_GetTick() - stream.since >= STREAM_FLUSH_MS )
+		StreamFlush();
+
+	for( i = 0; i < NUM_SESSIONS; ++i )
 	{
-		char *response = SCPI_Execute( cmd_buffer );
-		if( response )
+		SCPI_SESSION *ses = &sessions[ ( first + i ) % NUM_SESSIONS ];
+		SCPI_LINE *line;
+		char *cmd;
+		int c;
+
+		if( ses->clear && ses->clear() )
+			SessionClear( ses );
+
+		if( ses->status )
+			ses->status( StatusByte( ses ) );
+
+		if( ses->lost && ses->lost() )					// the line being assembled has a gap: drop it up to its '\n'
+		{
+			if( ses->count < SCPI_QUEUE_SIZE )
+				ses->queue[ ( ses->head + ses->count ) % SCPI_QUEUE_SIZE ].len = 0;
+			ses->discard = 1;
+			ses->esr |= ESR_DDE;
+		}
+
+		while( ses->count < SCPI_QUEUE_SIZE && ( c = ses->getc() ) >= 0 )	// queue full: the transport holds back or loses input
 		{
-			if( buf_ready == 1 )	// command came from from RS232
+			if( ses->discard )
 			{
-				scpi_printf( "%s\n", response );
+				ses->discard = ( c != '\n' );
+				continue;
 			}
-			else					// command came from USB
+
+			line = &ses->queue[ ( ses->head + ses->count ) % SCPI_QUEUE_SIZE ];
+			LineFeed( line, c );
+			if( line->done )
+				ses->count++;
+		}
+
+		if( ses->fetch && !Fetch( ses ) && !FetchBypass( ses ) )	// readings still to go out first, *TRG / ABOR may end the wait
+			continue;
+
+		if( !ses->count )
+			continue;
+
+		line = &ses->queue[ses->head];
+		if( !ses->next )
+			ses->next = line->text;
+		while( isspace( (uint8_t)*ses->next ) )
+			++ses->next;
+		if( *ses->next == ':' )							// ";:INIT" - from the root, where every command starts anyway
+			++ses->next;
+
+		if( JobWait( ses, ses->next ) )					// polled again when the job is done
+			continue;
+
+		if( ses->writeFree() <= sizeof(ses->out) )		// host not reading: wait, the response must fit
+			continue;
+
+		cmd = strsep( &ses->next, ";" );				// multiple commands can be chained
+		if( *cmd )
+		{
+			char *response = SCPI_Execute( ses, cmd );
+			if( response )
 			{
-				int l = snprintf( cmd_buffer, sizeof(cmd_buffer), "%s\n", response );
-				CDC_Transmit_FS( (uint8_t*)response, l );
+				ses_puts( ses, response );
+				ses_end( ses );
 			}
 		}
+
+		if( !ses->next )								// line done
+		{
+			line->done = line->len = 0;
+			ses->head = ( ses->head + 1 ) % SCPI_QUEUE_SIZE;
+			ses->count--;
+		}
+		more = 1;						// more input may be waiting
 	}
 
-	buf_ready = buf_busy = buf_pos = 0;							// invalidate buffer
-	HAL_UART_Receive_IT( &huart1, (uint8_t*)cmd_buffer, 1 );	// trigger reception of first character
+	first = ( first + 1 ) % NUM_SESSIONS;
+
+	if( more )
+		SCHED_Signal( TASK_SCPI );
 }
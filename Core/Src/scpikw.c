@@ -0,0 +1,154 @@
+/*
+ * scpikw.c
+ *
+ *  Created on: 19.10.2026
+ *      Author: aziemer
+ *
+ *  SCPI keywords and their matching.
+ *
+ *  Upper case letters of a keyword are the short form, every run of lower case letters
+ *  may be given in full or left out, case is ignored: "VOLTage" matches VOLT and VOLTAGE,
+ *  "FourwireRESistance" matches FRES, FRESISTANCE, FOURWIRERES and FOURWIRERESISTANCE.
+ *
+ *  SCPI_Match() does not try all keywords in turn: a perfect hash over all accepted forms,
+ *  generated by Tools/scpihash.py into scpi_hash.h, yields the only candidate, which is then
+ *  verified. Both steps are linear in the length of the keyword.
+ *  Run "make scpi_hash" after changing scpi_keywords[], "make scpibench" for a host benchmark.
+ */
+
+#include <stdint.h>
+#include <ctype.h>
+
+#include "scpikw.h"
+#include "scpi_hash.h"
+
+const char * const scpi_keywords[] = {		// Tools/scpihash.py reads this table
+	"*IDN",
+	"*RST",
+	"*OPC",
+	"*WAI",
+	"*ESR",
+	"*TRG",
+	"*CLS",
+	"*ESE",
+	"*SRE",
+	"*STB",
+	"SENSe",
+	"CONFigure",
+	"CALCulate",
+	"SYSTem",
+	"AUTO",
+	"RANGe",
+	"RATE",
+	"MEASure",			// with ? only
+	"FUNCtion",
+	"VOLTage",
+	"CURRent",
+	"FREQuency",
+	"PERiod",
+	"CAPacitance",
+	"CONTinuity",
+	"DIODe",
+	"FourwireRESistance",
+	"RESistance",
+	"TEMPerature",
+	"RTD",
+	"TYPe",
+	"UNIT",
+	"SHOW",
+	"SCALe",
+	"THREshold",
+	"AVERage",
+	"ALL",
+	"MAXimum",
+	"MINimum",
+	"DBM",
+	"DB",
+	"REFerence",
+	"NULL",
+	"OFFSet",
+	"STATe",
+	"BEEPer",
+	"DATE",
+	"TIME",
+	"LOCal",
+	"REMote",
+	"DEFault",
+	"CALibrate",
+	"SECure",
+	"VALue",
+	"AC",
+	"DC",
+	"DISPlay",
+	"FILTer",
+	"FRAMe",
+	"TASK",
+	"INITiate",
+	"FETCh",
+	"READ",
+	"TRIGger",
+	"SOURce",
+	"DELay",
+	"SAMPle",
+	"COUNt",
+	"IMMediate",
+	"BUS",
+	"ABORt",
+	"FORMat",
+	"DATA",
+	"ASCii",
+	"REAL",
+	"INTeger",
+	"BORDer",
+	"NORMal",
+	"SWAPped",
+	"STReam",
+	"ON",
+	"OFF",
+	"NONe"
+};
+
+static uint8_t SCPI_Form( const char *pattern, const char *cmd )	// 1: cmd is one of the forms of pattern
+{
+	while( *pattern )
+	{
+		if( islower( (uint8_t)*pattern ) )				// lower case run: try it in full, else leave it out
+		{
+			const char *run = pattern, *c = cmd;
+
+			while( islower( (uint8_t)*pattern ) )
+				++pattern;
+
+			while( run < pattern && toupper( (uint8_t)*c ) == toupper( (uint8_t)*run ) )
+				++run, ++c;
+
+			if( run == pattern && SCPI_Form( pattern, c ) )
+				return 1;
+			continue;
+		}
+
+		if( toupper( (uint8_t)*cmd ) != *pattern )
+			return 0;
+		++pattern;
+		++cmd;
+	}
+
+	return !*cmd;
+}
+
+int SCPI_Match( const char *keyword )		// SCPI_xxx, -1 if none
+{
+	const uint8_t *p;
+	uint32_t h = SCPI_HASH_BASIS;
+	uint8_t kw;
+
+	for( p = (const uint8_t*)keyword; *p; ++p )
+		h = ( h ^ ( *p & 0xDF ) ) * SCPI_HASH_PRIME;		// case folded
+
+	kw = scpi_hash_slot[ ( ( h >> 8 ) ^ scpi_hash_disp[ h & ( SCPI_HASH_BUCKETS - 1 ) ] ) & ( SCPI_HASH_SLOTS - 1 ) ];
+
+	if( kw >= SCPI_NUM_STRINGS || !SCPI_Form( scpi_keywords[kw], keyword ) )
+		return -1;
+
+	return kw;
+}
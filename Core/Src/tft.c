@@ -52,11 +52,29 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "gpio.h"
 #include "tft.h"
 #include "gfxfont.h"
+#include "numfmt.h"
 
 #include "FreeSansBold9pt7b.h"
 #include "FreeSansBold12pt7b.h"
 #include "font32x50.h"
 
+#include "FreeSansBold9pt7b_render.h"		// generated by Tools/fontspans.py
+#include "FreeSansBold12pt7b_render.h"
+#include "font32x50_render.h"
+
+typedef struct {
+	const GFXfont *gfx;
+	const uint8_t *spans;			// run-length encoded glyph rows, NULL: decode bitmap
+	const uint16_t *spanOffset;		// start of each glyph in spans[]
+	const GFXmetrics *metrics;
+} TFTFONT;
+
+static const TFTFONT tft_fonts[] = {
+	{ &FreeSansBold9pt7b,	FreeSansBold9pt7bSpans,		FreeSansBold9pt7bSpanOffsets,	&FreeSansBold9pt7bMetrics },	// FONT_10X16
+	{ &FreeSansBold12pt7b,	FreeSansBold12pt7bSpans,	FreeSansBold12pt7bSpanOffsets,	&FreeSansBold12pt7bMetrics },	// FONT_16X24
+	{ &font32x50,			font32x50Spans,				font32x50SpanOffsets,			&font32x50Metrics }				// FONT_32X50
+};
+
 #if (BOOTLOADER==0)
 const uint16_t tft_init_data[] =		// Command bytes have 0x100 added
 {
@@ -144,13 +162,47 @@ static int16_t tft_font_bottomy = 0;	// tallest under-cut below base-line (posit
 static int16_t tft_fontsize = 1;
 
 static const GFXfont *gfxFont = NULL;
+static const TFTFONT *tft_font = NULL;
+static uint8_t tft_use_spans = 1;		// 0: always decode glyph bitmaps (benchmark reference)
+
+#ifdef TFT_BENCHMARK
+static uint32_t tft_busBytes = 0;		// bytes written to the display
+#define BUS_COUNT(n)	tft_busBytes += (n)
+#else
+#define BUS_COUNT(n)
+#endif
 
 static inline void transfer( uint8_t val )
 {
-	HAL_GPIO_WritePin( LCD_WR_GPIO_Port, LCD_WR_Pin, GPIO_PIN_RESET );	// low
+	BUS_COUNT( 1 );
+	LCD_WR_GPIO_Port->BRR = LCD_WR_Pin;									// low
 	GPIOA->BSRR = ( val & 0xFF ) | ( (uint32_t)( ~val & 0xFF ) << 16 );	// set DATA byte
 	asm volatile ("nop");
-	HAL_GPIO_WritePin( LCD_WR_GPIO_Port, LCD_WR_Pin, GPIO_PIN_SET );	// high
+	LCD_WR_GPIO_Port->BSRR = LCD_WR_Pin;								// high
+}
+
+static void writeRun( uint16_t color, uint32_t count )	// RS must be high (data)
+{
+	if( ( color >> 8 ) == ( color & 0xFF ) )			// both bytes equal (i.e. black, white): set DATA once, then only strobe WR
+	{
+		GPIOA->BSRR = ( color & 0xFF ) | ( (uint32_t)( ~color & 0xFF ) << 16 );
+		count *= 2;
+		BUS_COUNT( count );
+		while( count-- )
+		{
+			LCD_WR_GPIO_Port->BRR = LCD_WR_Pin;			// low
+			asm volatile ("nop");
+			LCD_WR_GPIO_Port->BSRR = LCD_WR_Pin;		// high
+		}
+	}
+	else
+	{
+		while( count-- )
+		{
+			transfer( color >> 8 );
+			transfer( color & 0xFF );
+		}
+	}
 }
 
 static inline void startWrite( void )
@@ -169,11 +221,7 @@ static void lcdWriteData16Repeat( uint16_t data, uint32_t count )
 	transfer( 0x2C );
 
 	HAL_GPIO_WritePin( LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_SET );	// high
-	while( count-- )
-	{
-		transfer( data >> 8 );
-		transfer( data & 0xFF );
-	}
+	writeRun( data, count );
 }
 
 static void setXY( uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2 )
@@ -224,7 +272,7 @@ static void TFT_setRegister( uint8_t reg, uint8_t num, uint8_t *param )
 	HAL_GPIO_WritePin( LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_RESET );	// low
 	transfer( reg );
 
-	HAL_GPIO_WritePin( LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_RESET );	// high
+	HAL_GPIO_WritePin( LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_SET );	// high
 	while( num-- ) transfer( *param++ );
 
 	endWrite();
@@ -250,17 +298,19 @@ void TFT_setForeGround( uint16_t color )
 	tft_fgcolor = color;
 }
 
-static void lcd_write_xy( uint16_t x1, uint16_t y1,  uint16_t x2, uint16_t y2, uint16_t color )
+static void fillSpan( int x1, int y1, int x2, int y2 )	// fill [x1..x2] x [y1..y2] with tft_fgcolor, CS must be low
 {
+	if( x2 < x1 || y2 < y1 )
+		return;
+
 	setXY( x1, y1, x2, y2 );
-	transfer( color >> 8 );
-	transfer( color & 0xFF );
+	lcdWriteData16Repeat( tft_fgcolor, (uint32_t)( x2 - x1 + 1 ) * ( y2 - y1 + 1 ) );
 }
 
 static void drawPixel( int x, int y )
 {
 	startWrite();
-	lcd_write_xy( x, y, x, y, tft_fgcolor );
+	fillSpan( x, y, x, y );
 	endWrite();
 }
 
@@ -273,8 +323,7 @@ static void drawHLine( int x, int y, int l )
 	}
 
 	startWrite();
-	setXY( x, y, x + l, y );
-	lcdWriteData16Repeat( tft_fgcolor, l );
+	fillSpan( x, y, x + l - 1, y );
 	endWrite();
 }
 
@@ -287,11 +336,14 @@ static void drawVLine( int x, int y, int l )
 	}
 
 	startWrite();
-	setXY( x, y, x, y + l );
-	lcdWriteData16Repeat( tft_fgcolor, l );
+	fillSpan( x, y, x, y + l - 1 );
 	endWrite();
 }
 
+/*
+ * Bresenham, but pixels are collected into runs along the major axis:
+ * a run is sent as one span as soon as the minor coordinate changes.
+ */
 void TFT_drawLine( int x1, int y1, int x2, int y2 )
 {
 	if( y1 == y2 )
@@ -300,44 +352,52 @@ void TFT_drawLine( int x1, int y1, int x2, int y2 )
 		drawVLine( x1, y1, y2 - y1 );
 	else
 	{
-		unsigned int dx = ( x2 > x1 ? x2 - x1 : x1 - x2 );
-		short xstep = x2 > x1 ? 1 : -1;
-		unsigned int dy = ( y2 > y1 ? y2 - y1 : y1 - y2 );
-		short ystep = y2 > y1 ? 1 : -1;
-		int col = x1, row = y1;
+		int dx = ( x2 > x1 ? x2 - x1 : x1 - x2 );
+		int xstep = x2 > x1 ? 1 : -1;
+		int dy = ( y2 > y1 ? y2 - y1 : y1 - y2 );
+		int ystep = y2 > y1 ? 1 : -1;
+		int col = x1, row = y1, start;
 
 		startWrite();
-		if( dx < dy )
+		if( dx < dy )					// steep: vertical runs
 		{
 			int t = -( dy >> 1 );
-			while( 1 )
+
+			for( start = row; ; row += ystep )
 			{
-				lcd_write_xy( col, row, col, row, tft_fgcolor );
-				if( row == y2 )
-					return;
-				row += ystep;
 				t += dx;
-				if( t >= 0 )
+				if( row == y2 || t >= 0 )	// column changes after this pixel
 				{
+					if( ystep > 0 )	fillSpan( col, start, col, row );
+					else			fillSpan( col, row, col, start );
+
+					if( row == y2 )
+						break;
+
 					col += xstep;
 					t -= dy;
+					start = row + ystep;
 				}
 			}
 		}
-		else
+		else							// flat: horizontal runs
 		{
 			int t = -( dx >> 1 );
-			while( 1 )
+
+			for( start = col; ; col += xstep )
 			{
-				lcd_write_xy( col, row, col, row, tft_fgcolor );
-				if( col == x2 )
-					return;
-				col += xstep;
 				t += dy;
-				if( t >= 0 )
+				if( col == x2 || t >= 0 )	// row changes after this pixel
 				{
+					if( xstep > 0 )	fillSpan( start, row, col, row );
+					else			fillSpan( col, row, start, row );
+
+					if( col == x2 )
+						break;
+
 					row += ystep;
 					t -= dx;
+					start = col + xstep;
 				}
 			}
 		}
@@ -371,43 +431,90 @@ void TFT_drawRoundRect( int x1, int y1, int x2, int y2 )
 {
 	if( ( x2 - x1 ) > 4 && ( y2 - y1 ) > 4 )
 	{
-		drawPixel( x1 + 1, y1 + 1 );
-		drawPixel( x2 - 1, y1 + 1 );
-		drawPixel( x1 + 1, y2 - 1 );
-		drawPixel( x2 - 1, y2 - 1 );
-		drawHLine( x1 + 2, y1, x2 - x1 - 4 );
-		drawHLine( x1 + 2, y2, x2 - x1 - 4 );
-		drawVLine( x1, y1 + 2, y2 - y1 - 4 );
-		drawVLine( x2, y1 + 2, y2 - y1 - 4 );
+		startWrite();
+		fillSpan( x1 + 1, y1 + 1, x1 + 1, y1 + 1 );
+		fillSpan( x2 - 1, y1 + 1, x2 - 1, y1 + 1 );
+		fillSpan( x1 + 1, y2 - 1, x1 + 1, y2 - 1 );
+		fillSpan( x2 - 1, y2 - 1, x2 - 1, y2 - 1 );
+		fillSpan( x1 + 2, y1, x2 - 2, y1 );
+		fillSpan( x1 + 2, y2, x2 - 2, y2 );
+		fillSpan( x1, y1 + 2, x1, y2 - 2 );
+		fillSpan( x2, y1 + 2, x2, y2 - 2 );
+		endWrite();
 	}
 }
 
-void TFT_fillRoundRect( int x1, int y1, int x2, int y2 )
+/*
+ * Streaming access for callers composing their own pixel runs:
+ * TFT_beginWindow(), any number of TFT_writeRun() filling the window row by row, TFT_endWindow().
+ */
+void TFT_beginWindow( int x1, int y1, int x2, int y2 )
+{
+	startWrite();
+	setXY( x1, y1, x2, y2 );
+	HAL_GPIO_WritePin( LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_RESET );	// low
+	transfer( 0x2C );
+	HAL_GPIO_WritePin( LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_SET );	// high
+}
+
+void TFT_writeRun( uint16_t color, uint32_t count )
+{
+	writeRun( color, count );
+}
+
+void TFT_endWindow( void )
+{
+	endWrite();
+}
+
+/*
+ * Hardware scrolling. The controller scrolls along its gate lines, which - with MV set in
+ * MADCTL (0x36) - are the X axis: the scroll area is a band of columns over the full height.
+ */
+void TFT_setScrollArea( uint16_t left, uint16_t width )
+{
+	uint16_t right = TFT_WIDTH - left - width;
+	uint8_t param[6] = { left >> 8, left & 0xFF, width >> 8, width & 0xFF, right >> 8, right & 0xFF };
+
+	TFT_setRegister( 0x33, 6, param );		// VERTICAL SCROLLING DEFINITION: TFA, VSA, BFA
+}
+
+void TFT_setScrollPos( uint16_t x )			// display column 'left' of the scroll area shows memory column x
 {
-	int i;
+	uint8_t param[2] = { x >> 8, x & 0xFF };
 
+	TFT_setRegister( 0x37, 2, param );		// VERTICAL SCROLLING START ADDRESS
+}
+
+void TFT_resetScroll( void )
+{
+	TFT_setScrollArea( 0, TFT_WIDTH );
+	TFT_setScrollPos( 0 );
+	TFT_setRegister( 0x13, 0, NULL );		// NORMAL DISPLAY MODE ON
+}
+
+/*
+ * The two rounded rows at top and bottom are spans of their own, so the corner pixels keep
+ * whatever is underneath (a button overlay must not paint them), everything in between is a single run.
+ */
+void TFT_fillRoundRect( int x1, int y1, int x2, int y2 )
+{
 	if( ( x2 - x1 ) > 4 && ( y2 - y1 ) > 4 )
 	{
-		for( i = 0; i < ( ( y2 - y1 ) / 2 ) + 1; ++i )
-		{
-			switch( i )
-			{
-			case 0:
-				drawHLine( x1 + 2, y1 + i, x2 - x1 - 4 );
-				drawHLine( x1 + 2, y2 - i, x2 - x1 - 4 );
-				break;
-			case 1:
-				drawHLine( x1 + 1, y1 + i, x2 - x1 - 2 );
-				drawHLine( x1 + 1, y2 - i, x2 - x1 - 2 );
-				break;
-			default:
-				drawHLine( x1, y1 + i, x2 - x1 );
-				drawHLine( x1, y2 - i, x2 - x1 );
-			}
-		}
+		startWrite();
+		fillSpan( x1 + 2, y1, x2 - 2, y1 );
+		fillSpan( x1 + 1, y1 + 1, x2 - 1, y1 + 1 );
+		fillSpan( x1, y1 + 2, x2, y2 - 2 );
+		fillSpan( x1 + 1, y2 - 1, x2 - 1, y2 - 1 );
+		fillSpan( x1 + 2, y2, x2 - 2, y2 );
+		endWrite();
 	}
 }
 
+/*
+ * Midpoint circle, the pixels of each octant are collected into runs:
+ * rows above/below the center become horizontal spans, columns left/right vertical spans.
+ */
 void TFT_drawCircle( int x, int y, int radius )
 {
 	int f = 1 - radius;
@@ -415,34 +522,39 @@ void TFT_drawCircle( int x, int y, int radius )
 	int ddF_y = -2 * radius;
 	int x1 = 0;
 	int y1 = radius;
+	int xs = 0;							// start of the current run
 
 	startWrite();
 
-	lcd_write_xy( x, y + radius, x, y + radius, tft_fgcolor );
-	lcd_write_xy( x, y - radius, x, y - radius, tft_fgcolor );
-	lcd_write_xy( x + radius, y, x + radius, y, tft_fgcolor );
-	lcd_write_xy( x - radius, y, x - radius, y, tft_fgcolor );
-
-	while( x1 < y1 )
+	for(;;)
 	{
-		if( f >= 0 )
+		uint8_t last = ( x1 >= y1 );
+
+		if( last || f >= 0 )			// y1 changes after this pixel -> flush the run xs..x1
 		{
+			fillSpan( x + xs, y + y1, x + x1, y + y1 );		// bottom
+			fillSpan( x + xs, y - y1, x + x1, y - y1 );		// top
+			fillSpan( x + y1, y + xs, x + y1, y + x1 );		// right
+			fillSpan( x - y1, y + xs, x - y1, y + x1 );		// left
+
+			if( xs == 0 )				// don't draw the axes twice
+				xs = 1;
+			fillSpan( x - x1, y + y1, x - xs, y + y1 );
+			fillSpan( x - x1, y - y1, x - xs, y - y1 );
+			fillSpan( x + y1, y - x1, x + y1, y - xs );
+			fillSpan( x - y1, y - x1, x - y1, y - xs );
+
+			if( last )
+				break;
+
 			y1--;
 			ddF_y += 2;
 			f += ddF_y;
+			xs = x1 + 1;
 		}
 		x1++;
 		ddF_x += 2;
 		f += ddF_x;
-
-		lcd_write_xy( x + x1, y + y1, x + x1, y + y1, tft_fgcolor );
-		lcd_write_xy( x - x1, y + y1, x - x1, y + y1, tft_fgcolor );
-		lcd_write_xy( x + x1, y - y1, x + x1, y - y1, tft_fgcolor );
-		lcd_write_xy( x - x1, y - y1, x - x1, y - y1, tft_fgcolor );
-		lcd_write_xy( x + y1, y + x1, x + y1, y + x1, tft_fgcolor );
-		lcd_write_xy( x - y1, y + x1, x - y1, y + x1, tft_fgcolor );
-		lcd_write_xy( x + y1, y - x1, x + y1, y - x1, tft_fgcolor );
-		lcd_write_xy( x - y1, y - x1, x - y1, y - x1, tft_fgcolor );
 	}
 
 	endWrite();
@@ -450,20 +562,43 @@ void TFT_drawCircle( int x, int y, int radius )
 
 void TFT_fillCircle( int x, int y, int radius )
 {
-	int x1, y1;
+	int f = 1 - radius;
+	int ddF_x = 1;
+	int ddF_y = -2 * radius;
+	int x1 = 0, px = 0;
+	int y1 = radius, py = radius;
 
-	for( y1 = -radius; y1 <= 0; y1++ )
+	startWrite();
+
+	fillSpan( x - radius, y, x + radius, y );	// center row
+
+	while( x1 < y1 )
 	{
-		for( x1 = -radius; x1 <= 0; x1++ )
+		if( f >= 0 )
 		{
-			if( x1 * x1 + y1 * y1 <= radius * radius )
-			{
-				drawHLine( x + x1, y + y1, -2 * x1 );
-				drawHLine( x + x1, y - y1, -2 * x1 );
-				break;
-			}
+			y1--;
+			ddF_y += 2;
+			f += ddF_y;
 		}
+		x1++;
+		ddF_x += 2;
+		f += ddF_x;
+
+		if( x1 <= y1 )					// rows near the center, each row only once
+		{
+			fillSpan( x - y1, y + x1, x + y1, y + x1 );
+			fillSpan( x - y1, y - x1, x + y1, y - x1 );
+		}
+		if( y1 != py )					// rows near top and bottom
+		{
+			fillSpan( x - px, y + py, x + px, y + py );
+			fillSpan( x - px, y - py, x + px, y - py );
+			py = y1;
+		}
+		px = x1;
 	}
+
+	endWrite();
 }
 
 #if 0
@@ -529,7 +664,7 @@ void drawButtonFrame( int x1, int y1, int x2, int y2 )
 }
 #endif
 
-int TFT_printf( const char *fmt, ... )
+static void drawCharBitmap( uint8_t c )
 {
 	const uint8_t *bitmap = gfxFont->bitmap;
 	int8_t xx, yy, x1, x2, ys, ye, xs, xe;
@@ -537,108 +672,208 @@ int TFT_printf( const char *fmt, ... )
 	uint8_t bits = 0, start_bits;
 	uint8_t bit = 0, start_bit;
 	uint16_t bo, start_bo, color;
-	char txt[200], *ptr = txt;
-	int len, ret;
-	va_list ap;
-	va_start( ap, fmt );
-
-	*txt = 0;
-	ret = vsnprintf( txt, sizeof(txt), fmt, ap );
-	txt[sizeof(txt)-1] = 0;
-	len = strlen( txt );
-	va_end( ap );
 
 	// tft_ypos = 0 is base line, y can go below. NEGATIVE y is ABOVE base
 	// tft_xpos = 0 is character left side, x can go left of it. NEGATIVE x is LEFT of 0.
 
-	while( len-- )
+	if( c < gfxFont->first || c > gfxFont->last )
+		return;
+
+	if( gfxFont->glyph )
 	{
-		uint8_t c = *ptr++;
+		const GFXglyph *glyph = &gfxFont->glyph[c - gfxFont->first];
+		bo = glyph->bitmapOffset;
+
+		// area of bitmap data
+		ys = glyph->yOffset;
+		ye = ys + glyph->height;
+		xs = glyph->xOffset;
+		xe = xs + glyph->width;
 
-		if( c >= gfxFont->first && c <= gfxFont->last )
+		xAdvance = glyph->xAdvance;
+	}
+	else
+	{
+		bo = (uint16_t)( c - gfxFont->first ) * gfxFont->fontHeight * ( ( gfxFont->fontWidth + 7 ) / 8 );
+
+		// area of bitmap data
+		ys = -gfxFont->fontHeight;
+		ye = 0;
+		xs = 0;
+		xe = gfxFont->fontWidth;
+
+		xAdvance = gfxFont->fontWidth + 2;
+	}
+
+	// canvas area
+	x1 = ( xs < 0 ) ? xs : 0;
+	x2 = ( xe > xAdvance ) ? xe : xAdvance;
+
+	startWrite();
+
+	setXY(	tft_xpos + tft_fontsize * x1,     tft_ypos + tft_fontsize * tft_font_topy,
+			tft_xpos + tft_fontsize * x2 - 1, tft_ypos + tft_fontsize * tft_font_bottomy - 1 );
+
+	HAL_GPIO_WritePin( LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_RESET );	// low
+	transfer( 0x2C );
+	HAL_GPIO_WritePin( LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_SET );	// high
+
+	for( yy = tft_font_topy; yy < tft_font_bottomy; ++yy )
+	{
+		start_bo = bo;
+		start_bit = bit;
+		start_bits = bits;
+
+		for( lines = 0; lines < tft_fontsize; ++lines )		// repeat each line 'tft_fontsize' times
 		{
-			bits = bit = 0;
+			bo = start_bo;
+			bit = start_bit;
+			bits = start_bits;
 
-			if( gfxFont->glyph )
+			for( xx = x1; xx < x2; ++xx )
 			{
-				const GFXglyph *glyph = &gfxFont->glyph[c - gfxFont->first];
-				bo = glyph->bitmapOffset;
+				color = tft_bgcolor;
 
-				// area of bitmap data
-				ys = glyph->yOffset;
-				ye = ys + glyph->height;
-				xs = glyph->xOffset;
-				xe = xs + glyph->width;
+				if( xx >= xs && xx < xe && yy >= ys && yy < ye )
+				{
+					if( !( bit++ & 7 ) ) bits = bitmap[ bo++ ];
+					if( bits & 0x80 ) color = tft_fgcolor;
+					bits <<= 1;
+				}
 
-				xAdvance = glyph->xAdvance;
+				for( count = tft_fontsize; count; --count )	// output 'tft_fontsize' pixels per dot
+				{
+					transfer( color >> 8 );
+					transfer( color & 0xFF );
+				}
 			}
-			else
-			{
-				bo = (uint16_t)( c - gfxFont->first ) * gfxFont->fontHeight * ( ( gfxFont->fontWidth + 7 ) / 8 );
+		}
+	}
 
-				// area of bitmap data
-				ys = -gfxFont->fontHeight;
-				ye = 0;
-				xs = 0;
-				xe = gfxFont->fontWidth;
+	endWrite();
 
-				xAdvance = gfxFont->fontWidth + 2;
-			}
+	tft_xpos += tft_fontsize * xAdvance;
+}
 
-			// canvas area
-			x1 = ( xs < 0 ) ? xs : 0;
-			x2 = ( xe > xAdvance ) ? xe : xAdvance;
+static void drawCharSpans( uint8_t c )	// same canvas as drawCharBitmap(), but emits constant color runs
+{
+	const GFXglyph *glyph = &gfxFont->glyph[c - gfxFont->first];
+	const uint8_t *row = tft_font->spans + tft_font->spanOffset[c - gfxFont->first];
+	int8_t yy, x1, x2, ys, ye, xs, xe;
+	uint8_t lines, n, i;
+	uint32_t bg = 0;						// background pixels not yet sent
+	uint16_t fs = tft_fontsize;
+
+	// area of bitmap data
+	ys = glyph->yOffset;
+	ye = ys + glyph->height;
+	xs = glyph->xOffset;
+	xe = xs + glyph->width;
+
+	// canvas area
+	x1 = ( xs < 0 ) ? xs : 0;
+	x2 = ( xe > glyph->xAdvance ) ? xe : glyph->xAdvance;
 
-			startWrite();
+	startWrite();
 
-			setXY(	tft_xpos + tft_fontsize * x1,     tft_ypos + tft_fontsize * tft_font_topy,
-					tft_xpos + tft_fontsize * x2 - 1, tft_ypos + tft_fontsize * tft_font_bottomy - 1 );
+	setXY(	tft_xpos + fs * x1,     tft_ypos + fs * tft_font_topy,
+			tft_xpos + fs * x2 - 1, tft_ypos + fs * tft_font_bottomy - 1 );
 
-			HAL_GPIO_WritePin( LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_RESET );	// low
-			transfer( 0x2C );
-			HAL_GPIO_WritePin( LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_SET );	// high
+	HAL_GPIO_WritePin( LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_RESET );	// low
+	transfer( 0x2C );
+	HAL_GPIO_WritePin( LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_SET );	// high
 
-			for( yy = tft_font_topy; yy < tft_font_bottomy; ++yy )
-			{
-				start_bo = bo;
-				start_bit = bit;
-				start_bits = bits;
+	for( yy = tft_font_topy; yy < tft_font_bottomy; ++yy )
+	{
+		if( yy < ys || yy >= ye )			// row outside of the bitmap
+		{
+			bg += (uint32_t)( x2 - x1 ) * fs * fs;
+			continue;
+		}
 
-				for( lines = 0; lines < tft_fontsize; ++lines )		// repeat each line 'tft_fontsize' times
+		for( lines = 0; lines < fs; ++lines )	// repeat each row 'tft_fontsize' times
+		{
+			const uint8_t *run = row + 1;
+
+			bg += ( xs - x1 ) * fs;
+
+			for( n = *row, i = 0; i < n; ++i )
+			{
+				if( i & 1 )					// foreground run: flush pending background first
 				{
-					bo = start_bo;
-					bit = start_bit;
-					bits = start_bits;
-
-					for( xx = x1; xx < x2; ++xx )
-					{
-						color = tft_bgcolor;
-
-						if( xx >= xs && xx < xe && yy >= ys && yy < ye )
-						{
-							if( !( bit++ & 7 ) ) bits = bitmap[ bo++ ];
-							if( bits & 0x80 ) color = tft_fgcolor;
-							bits <<= 1;
-						}
-
-						for( count = tft_fontsize; count; --count )	// output 'tft_fontsize' pixels per dot
-						{
-							transfer( color >> 8 );
-							transfer( color & 0xFF );
-						}
-					}
+					writeRun( tft_bgcolor, bg );
+					writeRun( tft_fgcolor, *run++ * fs );
+					bg = 0;
 				}
+				else
+					bg += *run++ * fs;
 			}
 
-			endWrite();
-
-			tft_xpos += tft_fontsize * xAdvance;
+			bg += ( x2 - xe ) * fs;
 		}
+
+		row += 1 + *row;
 	}
 
+	writeRun( tft_bgcolor, bg );
+
+	endWrite();
+
+	tft_xpos += fs * glyph->xAdvance;
+}
+
+static void drawChar( uint8_t c )
+{
+	if( c < gfxFont->first || c > gfxFont->last )
+		return;
+
+	if( tft_use_spans && tft_font && tft_font->spans )
+		drawCharSpans( c );
+	else
+		drawCharBitmap( c );
+}
+
+void TFT_putc( char c )
+{
+	drawChar( (uint8_t)c );
+}
+
+void TFT_puts( const char *txt )	// plain text, no formatting
+{
+	while( *txt )
+		drawChar( (uint8_t)*txt++ );
+}
+
+int TFT_printf( const char *fmt, ... )
+{
+	char txt[200], *ptr = txt;
+	int len, ret;
+	va_list ap;
+	va_start( ap, fmt );
+
+	*txt = 0;
+	ret = vsnprintf( txt, sizeof(txt), fmt, ap );
+	txt[sizeof(txt)-1] = 0;
+	len = strlen( txt );
+	va_end( ap );
+
+	while( len-- )
+		drawChar( *ptr++ );
+
 	return ret;
 }
 
+void TFT_clearText( int x1, int x2 )	// clear the character canvas [x1..x2) on the current base line
+{
+	if( x2 <= x1 )
+		return;
+
+	startWrite();
+	setXY( x1, tft_ypos + tft_fontsize * tft_font_topy, x2 - 1, tft_ypos + tft_fontsize * tft_font_bottomy - 1 );
+	lcdWriteData16Repeat( tft_bgcolor, (long)( x2 - x1 ) * tft_fontsize * ( tft_font_bottomy - tft_font_topy ) );
+	endWrite();
+}
+
 void TFT_setFontSize( uint8_t size )
 {
 	tft_fontsize = size;
@@ -646,25 +881,30 @@ void TFT_setFontSize( uint8_t size )
 
 uint8_t TFT_getFontHeight( void )
 {
-	return tft_fontsize * ( abs( tft_font_bottomy - tft_font_topy ) + 1 );	// topy < 0, bottomy >= 0
+	return tft_fontsize * tft_font->metrics->height;
+}
+
+uint8_t TFT_getCharWidth( char ch )
+{
+	uint8_t c = (uint8_t)ch - gfxFont->first;		// wraps for c < first
+
+	if( c <= gfxFont->last - gfxFont->first )
+		return tft_fontsize * tft_font->metrics->advance[c];
+	return 0;
 }
 
 size_t TFT_getStrWidth( char *txt )
 {
+	const uint8_t *advance = tft_font->metrics->advance;
+	uint8_t first = gfxFont->first, range = gfxFont->last - gfxFont->first;
 	size_t len = 0;
 	uint8_t c;
 
-	while( ( c = *txt++ ) > 0 )
+	while( *txt )
 	{
-		if( gfxFont->glyph )
-		{
-			if( c >= gfxFont->first && c <= gfxFont->last )
-			{
-				len += gfxFont->glyph[c - gfxFont->first].xAdvance;
-			}
-		}
-		else
-			len += gfxFont->xAdvance;
+		c = (uint8_t)*txt++ - first;
+		if( c <= range )
+			len += advance[c];
 	}
 
 	return len * tft_fontsize;
@@ -675,39 +915,105 @@ void TFT_setFont( uint8_t no )
 	switch( no )
 	{
 	default:
-	case FONT_10X16:	gfxFont = &FreeSansBold9pt7b; break;
-	case FONT_16X24:	gfxFont = &FreeSansBold12pt7b; break;
-	case FONT_32X50:	gfxFont = &font32x50; break;
+	case FONT_10X16:	tft_font = &tft_fonts[0]; break;
+	case FONT_16X24:	tft_font = &tft_fonts[1]; break;
+	case FONT_32X50:	tft_font = &tft_fonts[2]; break;
 	}
+	gfxFont = tft_font->gfx;
 
-	if( gfxFont->glyph )
+	tft_font_topy = tft_font->metrics->ascent;		// pre-computed by Tools/fontspans.py
+	tft_font_bottomy = tft_font->metrics->descent;
+	tft_fontsize = 1;
+}
+
+#ifdef TFT_BENCHMARK
+
+static uint32_t benchmarkFont( uint8_t font )	// returns glyphs/s
+{
+	const char *txt = "0123456789";
+	uint32_t start, glyphs = 0;
+
+	TFT_setFont( font );
+	start = HAL_GetTick();
+	do
 	{
-		uint8_t c;
-		int16_t yy;
+		const char *p;
 
-		tft_font_topy = 127;
-		tft_font_bottomy = -127;
+		TFT_setXPos( 0 );
+		TFT_setYPos( 100 );
+		for( p = txt; *p; ++p )
+			drawChar( *p );
+		glyphs += strlen( txt );
+	}
+	while( HAL_GetTick() - start < 1000 );
 
-		for( c = gfxFont->first; c <= gfxFont->last; ++c )
-		{
-			const GFXglyph *glyph = &gfxFont->glyph[c - gfxFont->first];
+	return glyphs * 1000 / ( HAL_GetTick() - start );
+}
 
-			if( glyph->yOffset < tft_font_topy )
-				tft_font_topy = glyph->yOffset;
+static uint32_t benchmarkShape( uint8_t shape )	// returns bus bytes of one primitive
+{
+	uint32_t start = tft_busBytes;
 
-			yy = glyph->yOffset + glyph->height;
-			if( yy > tft_font_bottomy )
-				tft_font_bottomy = yy;
-		}
+	switch( shape )
+	{
+	case 0:	TFT_drawLine( 10, 120, 209, 170 ); break;		// flat diagonal
+	case 1:	TFT_drawLine( 220, 120, 250, 300 ); break;		// steep diagonal
+	case 2:	TFT_drawCircle( 320, 200, 50 ); break;
+	case 3:	TFT_fillCircle( 420, 200, 50 ); break;
+	case 4:	TFT_drawRoundRect( 10, 200, 109, 250 ); break;
+	case 5:	TFT_fillRoundRect( 120, 200, 219, 250 ); break;
 	}
-	else
+
+	return tft_busBytes - start;
+}
+
+void TFT_Benchmark( void )		// glyphs/s of bitmap decoder vs. span renderer for all fonts, bus bytes per shape
+{
+	static const uint8_t fonts[] = { FONT_10X16, FONT_16X24, FONT_32X50 };
+	static const char * const shapes[] = { "line 200x50", "line 30x180", "circle r50", "fillCircle r50", "roundRect 100x50", "fillRoundRect 100x50" };
+	uint32_t result[2][sizeof(fonts)], bytes[sizeof(shapes)/sizeof(shapes[0])], numfmt[2];
+	uint8_t i;
+
+	TFT_setBackGround( VGA_BLACK );
+	TFT_setForeGround( VGA_WHITE );
+
+	for( i = 0; i < sizeof(fonts); ++i )
 	{
-		tft_font_topy = 1 - gfxFont->fontHeight;
-		tft_font_bottomy = 0;
+		tft_use_spans = 0;
+		result[0][i] = benchmarkFont( fonts[i] );
+		tft_use_spans = 1;
+		result[1][i] = benchmarkFont( fonts[i] );
 	}
-	tft_fontsize = 1;
+
+	TFT_clearScreen( VGA_BLACK );
+	TFT_setForeGround( VGA_WHITE );
+	for( i = 0; i < sizeof(shapes)/sizeof(shapes[0]); ++i )
+		bytes[i] = benchmarkShape( i );
+
+	NUM_Benchmark( numfmt );
+
+	TFT_clearScreen( VGA_BLACK );
+	TFT_setForeGround( VGA_WHITE );
+	TFT_setFont( FONT_10X16 );
+	for( i = 0; i < sizeof(fonts); ++i )
+	{
+		TFT_setXPos( 10 );
+		TFT_setYPos( 30 + 25 * i );
+		TFT_printf( "font %d: bitmap %lu, spans %lu glyphs/s", fonts[i], result[0][i], result[1][i] );
+	}
+	for( i = 0; i < sizeof(shapes)/sizeof(shapes[0]); ++i )
+	{
+		TFT_setXPos( 10 );
+		TFT_setYPos( 130 + 25 * i );
+		TFT_printf( "%s: %lu bytes", shapes[i], bytes[i] );
+	}
+	TFT_setXPos( 10 );
+	TFT_setYPos( 130 + 25 * i );
+	TFT_printf( "%%+7.3f: sprintf %lu, NUM_Format %lu /s", numfmt[0], numfmt[1] );
 }
 
+#endif
+
 #if (BOOTLOADER==0)
 
 static void delay_us( uint16_t us )
@@ -0,0 +1,211 @@
+/*
+ * trend.c
+ *
+ *  Created on: 19.10.2026
+ *      Author: aziemer
+ *
+ *  Strip chart of the main reading, scrolled by the display controller.
+ *
+ *  The plot area is the controller's scroll area, so each sample costs one scroll command
+ *  plus one pixel column. The column written is always the one that has just wrapped around
+ *  from the left to the right edge. samples[] is indexed by memory column (not by screen
+ *  position), so a rescale can redraw the history in place without touching the scroll offset.
+ */
+
+#include <string.h>
+#include <math.h>
+
+#include "main.h"
+#include "tft.h"
+
+#include "dmm.h"
+#include "numfmt.h"
+#include "application.h"
+#include "trend.h"
+
+#define TREND_HEIGHT	( TREND_BOTTOM - TREND_TOP + 1 )
+#define NO_SAMPLE		-1
+
+static float samples[TREND_WIDTH];		// by memory column
+static uint16_t count = 0;				// valid samples in samples[]
+static uint16_t offset = 0;				// scroll offset, memory column shown at the left edge
+static int trendScale = SCALE_ILLEGAL;	// scale the axis has been drawn for
+static uint8_t active = 0;
+
+static int16_t ToRow( float val )		// sample -> row within plot area, NO_SAMPLE if invalid
+{
+	double fs = DMM_GetRange( trendScale );
+	float frac;
+	int16_t y;
+
+	if( DMM_isNAN( val ) || isinf( val ) || fs <= 0 )
+		return NO_SAMPLE;
+
+	frac = val / fs;
+	if( DMM_isDC( trendScale ) )		// bipolar: zero in the middle
+		y = ( TREND_HEIGHT - 1 ) / 2 - frac * ( ( TREND_HEIGHT - 1 ) / 2 );
+	else
+		y = ( TREND_HEIGHT - 1 ) - frac * ( TREND_HEIGHT - 1 );
+
+	if( y < 0 ) y = 0;
+	if( y > TREND_HEIGHT - 1 ) y = TREND_HEIGHT - 1;
+	return y;
+}
+
+static uint8_t isGridRow( int16_t y )	// 0%, 25%, 50%, 75% and 100% lines
+{
+	return ( ( y * 4 ) % ( TREND_HEIGHT - 1 ) ) < 4;
+}
+
+/*
+ * Draw one column as a vertical segment from the previous sample to this one,
+ * on top of background and grid, in a single address window.
+ */
+static void DrawColumn( uint16_t col, int16_t y, int16_t yprev )
+{
+	int16_t y1, y2, row;
+	uint16_t color, last = BACKGROUND_COLOR;
+	uint32_t run = 0;
+
+	if( yprev == NO_SAMPLE ) yprev = y;
+	y1 = ( y < yprev ) ? y : yprev;
+	y2 = ( y < yprev ) ? yprev : y;
+
+	TFT_beginWindow( TREND_XPOS + col, TREND_TOP, TREND_XPOS + col, TREND_BOTTOM );
+
+	for( row = 0; row < TREND_HEIGHT; ++row )
+	{
+		if( y != NO_SAMPLE && row >= y1 && row <= y2 )
+			color = TREND_COLOR;
+		else if( isGridRow( row ) )
+			color = TREND_GRID_COLOR;
+		else
+			color = BACKGROUND_COLOR;
+
+		if( color != last && run )
+		{
+			TFT_writeRun( last, run );
+			run = 0;
+		}
+		last = color;
+		++run;
+	}
+	TFT_writeRun( last, run );
+
+	TFT_endWindow();
+}
+
+static void DrawAxis( void )		// labels in the fixed area left of the plot
+{
+	const DMMDISP *disp = DMM_GetDisplay( trendScale );
+	char label[14];
+	uint8_t bipolar;
+	double fs;
+
+	TFT_setForeGround( BACKGROUND_COLOR );
+	TFT_fillRect( 0, TREND_TOP - SPACING, TREND_XPOS - 1, TFT_HEIGHT - 1 );
+
+	if( !disp )
+		return;
+	bipolar = ( disp->flags & DISP_DC ) != 0;
+	fs = disp->fullscale;
+
+	TFT_setFont( FONT_10X16 );
+	TFT_setForeGround( TREND_COLOR );
+	TFT_setBackGround( BACKGROUND_COLOR );
+
+	TFT_setXPos( 2 );
+	TFT_setYPos( TREND_TOP + TFT_getFontHeight() );
+	NUM_Fixed( label, NUM_Round( fs, 0 ), 0, 0, bipolar ? NUM_SIGN : 0 );		// full scale values are integers in display units
+	TFT_puts( label );
+
+	TFT_setXPos( 2 );
+	TFT_setYPos( TREND_TOP + TREND_HEIGHT / 2 + TFT_getFontHeight() / 2 );
+	TFT_puts( disp->unit );
+
+	TFT_setXPos( 2 );
+	TFT_setYPos( TREND_BOTTOM );
+	NUM_Fixed( label, bipolar ? -NUM_Round( fs, 0 ) : 0, 0, 0, 0 );
+	TFT_puts( label );
+}
+
+static void RedrawPlot( void )		// all columns, i.e. after a scale change
+{
+	uint16_t i, col = ( offset + TREND_WIDTH - count ) % TREND_WIDTH;	// oldest sample
+	int16_t y, yprev = NO_SAMPLE;
+
+	for( i = 0; i < TREND_WIDTH; ++i, col = ( col + 1 ) % TREND_WIDTH )
+	{
+		y = ( i < count ) ? ToRow( samples[col] ) : NO_SAMPLE;
+		DrawColumn( col, y, yprev );
+		yprev = y;
+	}
+}
+
+void TREND_Start( void )
+{
+	count = 0;
+	offset = 0;
+	trendScale = SCALE_ILLEGAL;
+
+	TFT_setForeGround( HEADER_COLOR );
+	TFT_fillRect( 0, 0, TFT_WIDTH - 1, HEADER_HEIGHT - 1 );		// must be uniform, it scrolls with the plot
+
+	TFT_setForeGround( BACKGROUND_COLOR );
+	TFT_fillRect( 0, HEADER_HEIGHT, BUTTON_XPOS - 1, TFT_HEIGHT - 1 );
+
+	TFT_setFont( FONT_10X16 );
+	TFT_setForeGround( HEADER_TEXT_COLOR );
+	TFT_setBackGround( HEADER_COLOR );
+	TFT_setXPos( 4 );
+	TFT_setYPos( HEADER_HEIGHT - 9 );
+	TFT_puts( "Trend" );
+
+	TFT_setScrollArea( TREND_XPOS, TREND_WIDTH );
+	TFT_setScrollPos( TREND_XPOS );
+
+	active = 1;
+}
+
+void TREND_Stop( void )
+{
+	if( !active )
+		return;
+
+	TFT_resetScroll();
+	active = 0;
+}
+
+uint8_t TREND_isActive( void )
+{
+	return active;
+}
+
+void TREND_AddSample( int scale, double val )
+{
+	uint16_t col, prev;
+
+	if( !active )
+		return;
+
+	if( scale != trendScale )			// (auto)range changed: new axis, re-map history
+	{
+		if( DMM_GetMode( scale ) != DMM_GetMode( trendScale ) )
+			count = 0;					// different quantity, history is meaningless
+		trendScale = scale;
+		DrawAxis();
+		RedrawPlot();
+	}
+
+	col = offset;						// leftmost column wraps around to the right edge
+	prev = ( col + TREND_WIDTH - 1 ) % TREND_WIDTH;
+
+	samples[col] = val;
+	if( count < TREND_WIDTH )
+		++count;
+
+	offset = ( offset + 1 ) % TREND_WIDTH;
+	TFT_setScrollPos( TREND_XPOS + offset );
+
+	DrawColumn( col, ToRow( val ), ( count > 1 ) ? ToRow( samples[prev] ) : NO_SAMPLE );
+}
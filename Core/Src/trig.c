@@ -0,0 +1,182 @@
+/*
+ * trig.c
+ *
+ *  Created on: 19.10.2026
+ *      Author: aziemer
+ *
+ *  SCPI trigger model: TRIG_Initiate() arms, the trigger source fires (at once, or on *TRG),
+ *  and after the trigger delay the next TRIG_GetCount() readings of channel 1 go into the buffer.
+ *  The acquisition keeps running all the time, so a reading is only taken if it was started
+ *  after the delay ran out, i.e. when the previous reading completed.
+ *  The buffer holds the readings as they are. Only FORM:DATA INT converts them, into counts of
+ *  TRIG_GetFactor(), the display resolution of the scale at the initiate, so a count is the last
+ *  digit the front panel shows. A range change during the capture (front panel, autorange) keeps
+ *  the buffer, a change of the measurement function ends the capture with an empty buffer.
+ */
+
+#include <math.h>
+
+#include "main.h"
+#include "dmm.h"
+#include "trig.h"
+#include "sched.h"
+
+enum {
+	STATE_IDLE,
+	STATE_ARMED,		// waiting for the trigger
+	STATE_DELAY,		// triggered, waiting for the delay to run out
+	STATE_CAPTURE		// filling the buffer
+};
+
+static uint8_t source = TRIG_IMMEDIATE;
+static uint16_t delay = 0;					// [ms]
+static uint8_t samples = 1;
+
+static volatile uint8_t state = STATE_IDLE;
+static uint8_t skip = 0;					// readings still to drop
+static uint32_t due = 0;					// HAL_GetTick() when the delay runs out
+static uint32_t started = 0;				// HAL_GetTick() when the reading in progress started
+static double buffer[TRIG_SAMPLES_MAX];		// [unit], +/-inf: overload
+static uint8_t count = 0;					// readings in buffer
+static double factor = 1;					// [unit/count]
+static int mode = -1;						// measurement function of the buffer
+
+void TRIG_SetSource( uint8_t src )
+{
+	source = src;
+}
+
+uint8_t TRIG_GetSource( void )
+{
+	return source;
+}
+
+void TRIG_SetDelay( uint16_t ms )
+{
+	delay = ms;
+}
+
+uint16_t TRIG_GetDelay( void )
+{
+	return delay;
+}
+
+void TRIG_SetCount( uint8_t n )
+{
+	samples = ( n < 1 ) ? 1 : ( n > TRIG_SAMPLES_MAX ) ? TRIG_SAMPLES_MAX : n;
+}
+
+uint8_t TRIG_GetCount( void )
+{
+	return samples;
+}
+
+static void Fire( void )
+{
+	due = HAL_GetTick() + delay;
+	state = STATE_DELAY;
+}
+
+void TRIG_Initiate( uint8_t drop )
+{
+	int scale = DMM_GetScale( 1 );
+	const DMMDISP *disp = DMM_GetDisplay( scale );
+	uint8_t i;
+
+	count = 0;
+	mode = DMM_GetMode( scale );
+	factor = 1;
+	if( disp )
+	{
+		factor = 1 / disp->factor;						// [unit] per digit of the display
+		for( i = 0; i < disp->fmt.decimals; ++i )
+			factor /= 10;
+	}
+	skip = drop;
+	state = STATE_ARMED;
+
+	if( source == TRIG_IMMEDIATE )
+		Fire();
+}
+
+void TRIG_Bus( void )
+{
+	if( state == STATE_ARMED && source == TRIG_BUS )
+		Fire();
+}
+
+void TRIG_Abort( void )
+{
+	state = STATE_IDLE;
+}
+
+uint8_t TRIG_Busy( void )
+{
+	return state != STATE_IDLE;
+}
+
+uint8_t TRIG_Readings( void )
+{
+	return count;
+}
+
+int32_t TRIG_GetRaw( uint8_t i )
+{
+	double val = ( i < count ) ? buffer[i] / factor : 0;
+
+	if( !( fabs( val ) < TRIG_OVERLOAD ) )		// also infinite
+		return signbit( val ) ? -TRIG_OVERLOAD : TRIG_OVERLOAD;
+
+	return lround( val );
+}
+
+double TRIG_GetFactor( void )
+{
+	return factor;
+}
+
+double TRIG_GetReading( uint8_t i )
+{
+	double val = ( i < count ) ? buffer[i] : 0;
+
+	if( !isfinite( val ) )
+		return signbit( val ) ? -TRIG_OVERLOAD_VALUE : TRIG_OVERLOAD_VALUE;
+
+	return val;
+}
+
+void TRIG_Reading( double val )		// a reading completed, it started when the previous one did
+{
+	uint32_t now = HAL_GetTick();
+
+	if( state != STATE_IDLE && DMM_GetMode( DMM_GetScale( 1 ) ) != mode )	// other function: the readings would not belong together
+	{
+		count = 0;
+		state = STATE_IDLE;
+		SCHED_Signal( TASK_SCPI );					// FETC? / READ? waiting: answered empty
+	}
+
+	switch( state )
+	{
+	case STATE_DELAY:
+		if( (int32_t)( started - due ) < 0 )		// started before the delay ran out
+			break;
+		if( skip )
+		{
+			--skip;
+			break;
+		}
+		state = STATE_CAPTURE;
+		// no break
+	case STATE_CAPTURE:
+		buffer[count++] = val;
+		if( count >= samples )
+		{
+			state = STATE_IDLE;
+			SCHED_Signal( TASK_SCPI );				// FETC? / READ? waiting
+		}
+		break;
+	}
+
+	started = now;
+}
@@ -0,0 +1,187 @@
+/**
+  ******************************************************************************
+  * @file    usbd_usbtmc.h
+  * @brief   header file for the usbd_usbtmc.c file.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USB_USBTMC_H
+#define __USB_USBTMC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include  "usbd_ioreq.h"
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+/** @defgroup usbd_usbtmc
+  * @brief This file is the Header file for usbd_usbtmc.c
+  * @{
+  */
+
+
+/** @defgroup usbd_usbtmc_Exported_Defines
+  * @{
+  */
+#ifndef TMC_INTERFACE
+#define TMC_INTERFACE                               0x02U  /* bInterfaceNumber, behind the two CDC interfaces */
+#endif /* TMC_INTERFACE */
+
+#define TMC_OUT_EP                                  0x03U  /* EP3 for Bulk-OUT messages */
+#define TMC_IN_EP                                   0x83U  /* EP3 for Bulk-IN responses */
+#define TMC_INT_EP                                  0x84U  /* EP4 for USB488 notifications */
+
+#ifndef TMC_FS_BINTERVAL
+#define TMC_FS_BINTERVAL                          0x01U
+#endif /* TMC_FS_BINTERVAL */
+
+#define TMC_DATA_FS_MAX_PACKET_SIZE                 64U  /* Bulk IN & OUT Packet size */
+#define TMC_INT_PACKET_SIZE                         2U   /* Interrupt IN Packet size: bNotify1, bNotify2 */
+
+#define USB_TMC_INTERFACE_DESC_SIZ                  30U  /* interface and its three endpoints */
+#define TMC_HEADER_SIZE                             12U  /* Bulk-OUT / Bulk-IN message header */
+
+/*---------------------------------------------------------------------*/
+/*  USBTMC / USB488 definitions                                        */
+/*---------------------------------------------------------------------*/
+/* MsgID of the Bulk-OUT / Bulk-IN header */
+#define TMC_DEV_DEP_MSG_OUT                         1U
+#define TMC_REQUEST_DEV_DEP_MSG_IN                  2U
+#define TMC_DEV_DEP_MSG_IN                          2U
+#define TMC_TRIGGER                                 128U  /* USB488 */
+
+/* bmTransferAttributes */
+#define TMC_ATTR_EOM                                0x01U
+
+/* class requests */
+#define TMC_INITIATE_ABORT_BULK_OUT                 1U
+#define TMC_CHECK_ABORT_BULK_OUT_STATUS             2U
+#define TMC_INITIATE_ABORT_BULK_IN                  3U
+#define TMC_CHECK_ABORT_BULK_IN_STATUS              4U
+#define TMC_INITIATE_CLEAR                          5U
+#define TMC_CHECK_CLEAR_STATUS                      6U
+#define TMC_GET_CAPABILITIES                        7U
+#define TMC_INDICATOR_PULSE                         64U
+#define TMC_READ_STATUS_BYTE                        128U  /* USB488 */
+
+/* USBTMC_status of the class request responses */
+#define TMC_STATUS_SUCCESS                          0x01U
+#define TMC_STATUS_PENDING                          0x02U
+#define TMC_STATUS_INTERRUPT_IN_BUSY                0x20U  /* USB488 */
+#define TMC_STATUS_FAILED                           0x80U
+#define TMC_STATUS_TRANSFER_NOT_IN_PROGRESS         0x81U
+
+/* bNotify1 of the Interrupt IN notifications */
+#define TMC_NOTIFY_STATUS                           0x80U  /* | bTag of the READ_STATUS_BYTE request */
+#define TMC_NOTIFY_SRQ                              0x81U
+
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_CORE_Exported_TypesDefinitions
+  * @{
+  */
+
+/**
+  * @}
+  */
+typedef struct _USBD_TMC_Itf
+{
+  int8_t (* Init)(void);
+  int8_t (* DeInit)(void);
+  int8_t (* Receive)(uint8_t *Buf, uint32_t Len, uint8_t eom);  /* once per Bulk-OUT packet, re-arm with USBD_TMC_ReceivePacket() */
+  int8_t (* Trigger)(void);                                      /* USB488 TRIGGER message, before its Receive() */
+  int8_t (* Request)(void);                                      /* REQUEST_DEV_DEP_MSG_IN, see USBD_TMC_Requested() */
+  int8_t (* TransmitCplt)(void);                                 /* Bulk-IN transfer done, an aborted one once the host has read it */
+  int8_t (* AbortIn)(void);                                      /* INITIATE_ABORT_BULK_IN: the rest of the response is dropped */
+  int8_t (* AbortOut)(void);                                     /* INITIATE_ABORT_BULK_OUT: the message received so far is dropped */
+  int8_t (* Clear)(void);                                        /* INITIATE_CLEAR */
+  uint8_t (* Cleared)(void);                                     /* CHECK_CLEAR_STATUS: 0 while still pending */
+  uint8_t (* StatusByte)(void);                                  /* READ_STATUS_BYTE */
+} USBD_TMC_ItfTypeDef;
+
+
+typedef struct
+{
+  uint32_t RxBuffer[TMC_DATA_FS_MAX_PACKET_SIZE / 4U];  /* Force 32bits alignment */
+  uint8_t  Response[24];                              /* class request responses */
+  uint8_t  Notify[TMC_INT_PACKET_SIZE];
+
+  uint32_t OutLeft;                                   /* bytes of the Bulk-OUT transfer still to come, 0: none */
+  uint32_t OutPayload;                                /* message bytes of them */
+  uint32_t OutReceived;                               /* message bytes received, NBYTES_RXD */
+  uint8_t  OutTag;                                    /* bTag of the last Bulk-OUT transfer */
+  uint8_t  OutEom;
+
+  uint8_t  InTag;                                     /* bTag of the REQUEST_DEV_DEP_MSG_IN */
+  uint32_t InMax;                                     /* its TransferSize */
+  uint32_t InSent;                                    /* message bytes of the Bulk-IN transfer, NBYTES_TXD */
+  __IO uint32_t InState;                              /* 0: no request, 1: requested, 2: Bulk-IN transfer running */
+  __IO uint32_t InBusy;                               /* Bulk-IN transfer armed, until its last packet went out */
+  __IO uint32_t InAborted;                            /* it was aborted or cleared, the host still reads it */
+  __IO uint32_t IntState;                             /* Interrupt IN notification in flight */
+}
+USBD_TMC_HandleTypeDef;
+
+
+
+/** @defgroup USBD_CORE_Exported_Macros
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_CORE_Exported_Variables
+  * @{
+  */
+
+extern USBD_ClassTypeDef  USBD_TMC;
+#define USBD_TMC_CLASS    &USBD_TMC
+/**
+  * @}
+  */
+
+/** @defgroup USB_CORE_Exported_Functions
+  * @{
+  */
+uint8_t  USBD_TMC_RegisterInterface(USBD_HandleTypeDef   *pdev,
+                                    USBD_TMC_ItfTypeDef *fops);
+
+uint8_t  USBD_TMC_ReceivePacket(USBD_HandleTypeDef *pdev);
+
+uint32_t USBD_TMC_Requested(USBD_HandleTypeDef *pdev);
+
+uint8_t  USBD_TMC_Transmit(USBD_HandleTypeDef *pdev,
+                           uint8_t *pbuff,
+                           uint32_t length,
+                           uint8_t eom);
+
+uint8_t  USBD_TMC_Notify(USBD_HandleTypeDef *pdev,
+                         uint8_t notify1,
+                         uint8_t notify2);
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __USB_USBTMC_H */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
@@ -0,0 +1,715 @@
+/**
+  ******************************************************************************
+  * @file    usbd_usbtmc.c
+  * @brief   This file provides the high layer firmware functions to manage the
+  *          following functionalities of the USBTMC / USB488 Class:
+  *           - Initialization and Configuration of high and low layer
+  *           - Bulk-OUT message framing (DEV_DEP_MSG_OUT, REQUEST_DEV_DEP_MSG_IN, TRIGGER)
+  *           - Bulk-IN responses (DEV_DEP_MSG_IN) with EOM
+  *           - Interrupt IN notifications (READ_STATUS_BYTE, SRQ)
+  *           - Class requests: abort, clear, capabilities, status byte
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                USBTMC Class Driver Description
+  *          ===================================================================
+  *           This driver manages the "Universal Serial Bus Test and Measurement
+  *           Class Specification (USBTMC) Revision 1.0" and its "USB488 Subclass
+  *           Specification Revision 1.0", full speed only.
+  *
+  *           The class has no descriptors of its own: it is one function of the
+  *           composite configuration (usbd_composite.c), which dispatches the
+  *           requests of interface TMC_INTERFACE and the endpoints TMC_xxx_EP
+  *           to it. Its state is static, as pClassData / pUserData belong to CDC.
+  *
+  *           Each Bulk-OUT packet goes to Receive() without its header and
+  *           alignment bytes, eom set with the last bytes of a message. The
+  *           endpoint stays NAKing until the interface re-arms it with
+  *           USBD_TMC_ReceivePacket(), so the host is paced.
+  *           A REQUEST_DEV_DEP_MSG_IN calls Request(), the interface answers it
+  *           with USBD_TMC_Transmit() when it has a response.
+  *
+  *           The endpoint FIFO can't be flushed, so an aborted or cleared
+  *           Bulk-IN transfer stays armed: CHECK_ABORT_BULK_IN_STATUS and
+  *           CHECK_CLEAR_STATUS report it as pending with data in the FIFO,
+  *           until the host has read it up to the short packet. No new
+  *           transfer starts before.
+  *
+  *           Not implemented: TermChar, INDICATOR_PULSE, the USB488 remote /
+  *           local control (REN_CONTROL, GO_TO_LOCAL, LOCAL_LOCKOUT, so the
+  *           capabilities claim no 488.2 interface and no SCPI compliance);
+  *           a bad Bulk-OUT header drops the packet instead of halting the
+  *           endpoint.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_usbtmc.h"
+#include "usbd_ctlreq.h"
+
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup USBD_TMC
+  * @brief usbd core module
+  * @{
+  */
+
+/** @defgroup USBD_TMC_Private_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_TMC_Private_Defines
+  * @{
+  */
+#define TMC_IN_IDLE                                 0U
+#define TMC_IN_REQUESTED                            1U
+#define TMC_IN_RUNNING                              2U
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_TMC_Private_Macros
+  * @{
+  */
+#define TMC_GET32(p)    ((uint32_t)(p)[0] | ((uint32_t)(p)[1] << 8) | ((uint32_t)(p)[2] << 16) | ((uint32_t)(p)[3] << 24))
+#define TMC_PUT32(p, v) do { (p)[0] = (uint8_t)(v); (p)[1] = (uint8_t)((v) >> 8); (p)[2] = (uint8_t)((v) >> 16); (p)[3] = (uint8_t)((v) >> 24); } while (0)
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_TMC_Private_FunctionPrototypes
+  * @{
+  */
+
+
+static uint8_t  USBD_TMC_Init(USBD_HandleTypeDef *pdev,
+                              uint8_t cfgidx);
+
+static uint8_t  USBD_TMC_DeInit(USBD_HandleTypeDef *pdev,
+                                uint8_t cfgidx);
+
+static uint8_t  USBD_TMC_Setup(USBD_HandleTypeDef *pdev,
+                               USBD_SetupReqTypedef *req);
+
+static uint8_t  USBD_TMC_DataIn(USBD_HandleTypeDef *pdev,
+                                uint8_t epnum);
+
+static uint8_t  USBD_TMC_DataOut(USBD_HandleTypeDef *pdev,
+                                 uint8_t epnum);
+
+static uint16_t USBD_TMC_ClassRequest(USBD_HandleTypeDef *pdev,
+                                      USBD_SetupReqTypedef *req);
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_TMC_Private_Variables
+  * @{
+  */
+
+
+/* USBTMC interface class callbacks structure */
+USBD_ClassTypeDef  USBD_TMC =
+{
+  USBD_TMC_Init,
+  USBD_TMC_DeInit,
+  USBD_TMC_Setup,
+  NULL,                 /* EP0_TxSent, */
+  NULL,                 /* EP0_RxReady, all class requests are IN */
+  USBD_TMC_DataIn,
+  USBD_TMC_DataOut,
+  NULL,
+  NULL,
+  NULL,
+  NULL,                 /* descriptors: see the composite configuration */
+  NULL,
+  NULL,
+  NULL,
+};
+
+static USBD_TMC_HandleTypeDef TMC_Handle;
+static USBD_TMC_ItfTypeDef *TMC_Fops = NULL;
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_TMC_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  USBD_TMC_Init
+  *         Initialize the USBTMC interface
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  USBD_TMC_Init(USBD_HandleTypeDef *pdev, uint8_t cfgidx)
+{
+  USBD_TMC_HandleTypeDef *htmc = &TMC_Handle;
+
+  UNUSED(cfgidx);
+
+  /* Open EP IN */
+  USBD_LL_OpenEP(pdev, TMC_IN_EP, USBD_EP_TYPE_BULK,
+                 TMC_DATA_FS_MAX_PACKET_SIZE);
+
+  pdev->ep_in[TMC_IN_EP & 0xFU].is_used = 1U;
+
+  /* Open EP OUT */
+  USBD_LL_OpenEP(pdev, TMC_OUT_EP, USBD_EP_TYPE_BULK,
+                 TMC_DATA_FS_MAX_PACKET_SIZE);
+
+  pdev->ep_out[TMC_OUT_EP & 0xFU].is_used = 1U;
+
+  /* Open Interrupt IN EP */
+  USBD_LL_OpenEP(pdev, TMC_INT_EP, USBD_EP_TYPE_INTR, TMC_INT_PACKET_SIZE);
+  pdev->ep_in[TMC_INT_EP & 0xFU].is_used = 1U;
+
+  /* Init Xfer states */
+  htmc->OutLeft = 0U;
+  htmc->OutPayload = 0U;
+  htmc->OutReceived = 0U;
+  htmc->OutTag = 0U;
+  htmc->OutEom = 0U;
+  htmc->InTag = 0U;
+  htmc->InMax = 0U;
+  htmc->InSent = 0U;
+  htmc->InState = TMC_IN_IDLE;
+  htmc->InBusy = 0U;
+  htmc->InAborted = 0U;
+  htmc->IntState = 0U;
+
+  if (TMC_Fops == NULL)
+  {
+    return 1U;
+  }
+
+  /* Init  physical Interface components */
+  TMC_Fops->Init();
+
+  /* Prepare Out endpoint to receive next packet */
+  USBD_LL_PrepareReceive(pdev, TMC_OUT_EP, (uint8_t *)(void *)htmc->RxBuffer,
+                         TMC_DATA_FS_MAX_PACKET_SIZE);
+
+  return 0U;
+}
+
+/**
+  * @brief  USBD_TMC_DeInit
+  *         DeInitialize the USBTMC layer
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  USBD_TMC_DeInit(USBD_HandleTypeDef *pdev, uint8_t cfgidx)
+{
+  UNUSED(cfgidx);
+
+  /* Close EP IN */
+  USBD_LL_CloseEP(pdev, TMC_IN_EP);
+  pdev->ep_in[TMC_IN_EP & 0xFU].is_used = 0U;
+
+  /* Close EP OUT */
+  USBD_LL_CloseEP(pdev, TMC_OUT_EP);
+  pdev->ep_out[TMC_OUT_EP & 0xFU].is_used = 0U;
+
+  /* Close Interrupt IN EP */
+  USBD_LL_CloseEP(pdev, TMC_INT_EP);
+  pdev->ep_in[TMC_INT_EP & 0xFU].is_used = 0U;
+
+  TMC_Handle.InState = TMC_IN_IDLE;
+  TMC_Handle.InBusy = 0U;
+  TMC_Handle.InAborted = 0U;
+
+  /* DeInit  physical Interface components */
+  if (TMC_Fops != NULL)
+  {
+    TMC_Fops->DeInit();
+  }
+
+  return 0U;
+}
+
+/**
+  * @brief  USBD_TMC_Setup
+  *         Handle the USBTMC specific requests
+  * @param  pdev: instance
+  * @param  req: usb requests
+  * @retval status
+  */
+static uint8_t  USBD_TMC_Setup(USBD_HandleTypeDef *pdev,
+                               USBD_SetupReqTypedef *req)
+{
+  USBD_TMC_HandleTypeDef *htmc = &TMC_Handle;
+  uint8_t ifalt = 0U;
+  uint16_t status_info = 0U;
+  uint16_t len;
+  uint8_t ret = USBD_OK;
+
+  switch (req->bmRequest & USB_REQ_TYPE_MASK)
+  {
+    case USB_REQ_TYPE_CLASS :
+      len = ((req->bmRequest & 0x80U) && req->wLength) ? USBD_TMC_ClassRequest(pdev, req) : 0U;
+
+      if (len)
+      {
+        USBD_CtlSendData(pdev, htmc->Response, MIN(len, req->wLength));
+      }
+      else
+      {
+        USBD_CtlError(pdev, req);
+        ret = USBD_FAIL;
+      }
+      break;
+
+    case USB_REQ_TYPE_STANDARD:
+      switch (req->bRequest)
+      {
+        case USB_REQ_GET_STATUS:
+          if (pdev->dev_state == USBD_STATE_CONFIGURED)
+          {
+            USBD_CtlSendData(pdev, (uint8_t *)(void *)&status_info, 2U);
+          }
+          else
+          {
+            USBD_CtlError(pdev, req);
+            ret = USBD_FAIL;
+          }
+          break;
+
+        case USB_REQ_GET_INTERFACE:
+          if (pdev->dev_state == USBD_STATE_CONFIGURED)
+          {
+            USBD_CtlSendData(pdev, &ifalt, 1U);
+          }
+          else
+          {
+            USBD_CtlError(pdev, req);
+            ret = USBD_FAIL;
+          }
+          break;
+
+        case USB_REQ_SET_INTERFACE:
+          if (pdev->dev_state != USBD_STATE_CONFIGURED)
+          {
+            USBD_CtlError(pdev, req);
+            ret = USBD_FAIL;
+          }
+          break;
+
+        default:
+          USBD_CtlError(pdev, req);
+          ret = USBD_FAIL;
+          break;
+      }
+      break;
+
+    default:
+      USBD_CtlError(pdev, req);
+      ret = USBD_FAIL;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  USBD_TMC_ClassRequest
+  *         Execute a USBTMC / USB488 class request, all of them return data
+  * @param  pdev: instance
+  * @param  req: usb requests
+  * @retval Length of the response in htmc->Response, 0 if not supported
+  */
+static uint16_t USBD_TMC_ClassRequest(USBD_HandleTypeDef *pdev,
+                                      USBD_SetupReqTypedef *req)
+{
+  USBD_TMC_HandleTypeDef *htmc = &TMC_Handle;
+  uint8_t *resp = htmc->Response;
+  uint8_t tag = LOBYTE(req->wValue);
+
+  switch (req->bRequest)
+  {
+    case TMC_INITIATE_ABORT_BULK_OUT:
+      if (htmc->OutLeft == 0U)
+      {
+        resp[0] = TMC_STATUS_FAILED;
+      }
+      else if (htmc->OutTag != tag)
+      {
+        resp[0] = TMC_STATUS_TRANSFER_NOT_IN_PROGRESS;
+      }
+      else
+      {
+        htmc->OutLeft = 0U;           /* the rest of the transfer is dropped */
+        TMC_Fops->AbortOut();
+        resp[0] = TMC_STATUS_SUCCESS;
+      }
+      resp[1] = htmc->OutTag;
+      return 2U;
+
+    case TMC_CHECK_ABORT_BULK_OUT_STATUS:
+      resp[0] = TMC_STATUS_SUCCESS;
+      resp[1] = resp[2] = resp[3] = 0U;
+      TMC_PUT32(&resp[4], htmc->OutReceived);
+      return 8U;
+
+    case TMC_INITIATE_ABORT_BULK_IN:
+      if (htmc->InState == TMC_IN_IDLE)
+      {
+        resp[0] = TMC_STATUS_FAILED;
+      }
+      else if (htmc->InTag != tag)
+      {
+        resp[0] = TMC_STATUS_TRANSFER_NOT_IN_PROGRESS;
+      }
+      else
+      {
+        if (htmc->InState == TMC_IN_RUNNING)
+        {
+          htmc->InAborted = 1U;       /* armed: done once the host has read it */
+        }
+        htmc->InState = TMC_IN_IDLE;
+        TMC_Fops->AbortIn();
+        resp[0] = TMC_STATUS_SUCCESS;
+      }
+      resp[1] = htmc->InTag;
+      return 2U;
+
+    case TMC_CHECK_ABORT_BULK_IN_STATUS:
+      resp[0] = htmc->InAborted ? TMC_STATUS_PENDING : TMC_STATUS_SUCCESS;
+      resp[1] = htmc->InAborted ? 0x01U : 0U;   /* bmAbortBulkIn: data in the FIFO, read it up to a short packet */
+      resp[2] = resp[3] = 0U;
+      TMC_PUT32(&resp[4], htmc->InSent);
+      return 8U;
+
+    case TMC_INITIATE_CLEAR:
+      htmc->OutLeft = 0U;
+      if (htmc->InState == TMC_IN_RUNNING)
+      {
+        htmc->InAborted = 1U;
+      }
+      htmc->InState = TMC_IN_IDLE;
+      TMC_Fops->Clear();
+      resp[0] = TMC_STATUS_SUCCESS;
+      return 1U;
+
+    case TMC_CHECK_CLEAR_STATUS:
+      resp[0] = (!htmc->InAborted && TMC_Fops->Cleared()) ? TMC_STATUS_SUCCESS : TMC_STATUS_PENDING;
+      resp[1] = htmc->InAborted ? 0x01U : 0U;   /* bmClear: data in the Bulk-IN FIFO */
+      return 2U;
+
+    case TMC_GET_CAPABILITIES:
+      for (tag = 0U; tag < 24U; ++tag)
+      {
+        resp[tag] = 0U;
+      }
+      resp[0] = TMC_STATUS_SUCCESS;
+      resp[2] = 0x00U;                /* bcdUSBTMC 1.00 */
+      resp[3] = 0x01U;
+      resp[12] = 0x00U;               /* bcdUSB488 1.00 */
+      resp[13] = 0x01U;
+      resp[14] = 0x01U;               /* USB488 interface: TRIGGER */
+      resp[15] = 0x05U;               /* USB488 device: SR1, DT1 */
+      return 24U;
+
+    case TMC_READ_STATUS_BYTE:
+      resp[1] = tag;
+      resp[2] = 0U;                   /* the status byte goes out on the Interrupt IN endpoint */
+      if (htmc->IntState != 0U)
+      {
+        resp[0] = TMC_STATUS_INTERRUPT_IN_BUSY;
+      }
+      else
+      {
+        resp[0] = TMC_STATUS_SUCCESS;
+        USBD_TMC_Notify(pdev, TMC_NOTIFY_STATUS | tag, TMC_Fops->StatusByte());
+      }
+      return 3U;
+
+    default:
+      return 0U;
+  }
+}
+
+/**
+  * @brief  USBD_TMC_DataIn
+  *         Data sent on non-control IN endpoint
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t  USBD_TMC_DataIn(USBD_HandleTypeDef *pdev, uint8_t epnum)
+{
+  USBD_TMC_HandleTypeDef *htmc = &TMC_Handle;
+
+  if (epnum == (TMC_INT_EP & 0xFU))
+  {
+    htmc->IntState = 0U;
+  }
+  else if ((pdev->ep_in[epnum].total_length > 0U) && ((pdev->ep_in[epnum].total_length % TMC_DATA_FS_MAX_PACKET_SIZE) == 0U))
+  {
+    /* Update the packet total length */
+    pdev->ep_in[epnum].total_length = 0U;
+
+    /* Send ZLP, a Bulk-IN transfer ends with a short packet */
+    USBD_LL_Transmit(pdev, epnum, NULL, 0U);
+  }
+  else if (htmc->InBusy != 0U)
+  {
+    htmc->InBusy = 0U;
+    if (htmc->InAborted != 0U)
+    {
+      htmc->InAborted = 0U;           /* InState is the one of the next request */
+    }
+    else
+    {
+      htmc->InState = TMC_IN_IDLE;
+    }
+    TMC_Fops->TransmitCplt();
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_TMC_DataOut
+  *         Data received on non-control Out endpoint: the header of a new
+  *         transfer is parsed, the message bytes go to Receive()
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t  USBD_TMC_DataOut(USBD_HandleTypeDef *pdev, uint8_t epnum)
+{
+  USBD_TMC_HandleTypeDef *htmc = &TMC_Handle;
+  uint8_t *pbuf = (uint8_t *)(void *)htmc->RxBuffer;
+  uint32_t size = USBD_LL_GetRxDataSize(pdev, epnum);
+  uint32_t len = size;
+  uint32_t n;
+
+  if (htmc->OutLeft == 0U)      /* new transfer */
+  {
+    htmc->OutPayload = 0U;
+    htmc->OutEom = 0U;
+
+    if ((len >= TMC_HEADER_SIZE) && ((uint8_t)(pbuf[1] ^ pbuf[2]) == 0xFFU))
+    {
+      n = TMC_GET32(&pbuf[4]);  /* TransferSize */
+
+      switch (pbuf[0])
+      {
+        case TMC_DEV_DEP_MSG_OUT:
+          htmc->OutTag = pbuf[1];
+          htmc->OutLeft = (n + 3U) & ~3U;   /* with the alignment bytes */
+          htmc->OutPayload = n;
+          htmc->OutReceived = 0U;
+          htmc->OutEom = pbuf[8] & TMC_ATTR_EOM;
+          break;
+
+        case TMC_REQUEST_DEV_DEP_MSG_IN:
+          htmc->InTag = pbuf[1];
+          htmc->InMax = n;
+          if (htmc->InBusy == 0U)       /* else the aborted transfer is still read */
+          {
+            htmc->InSent = 0U;
+          }
+          htmc->InState = TMC_IN_REQUESTED;
+          TMC_Fops->Request();
+          break;
+
+        case TMC_TRIGGER:
+          TMC_Fops->Trigger();
+          break;
+
+        default:                /* unknown MsgID: ignored */
+          break;
+      }
+    }
+
+    pbuf += TMC_HEADER_SIZE;
+    len = (len > TMC_HEADER_SIZE) ? len - TMC_HEADER_SIZE : 0U;
+  }
+
+  if (len > htmc->OutLeft)
+  {
+    len = htmc->OutLeft;
+  }
+  n = MIN(len, htmc->OutPayload);
+  htmc->OutPayload -= n;
+  htmc->OutReceived += n;
+  htmc->OutLeft -= len;
+
+  if (size < TMC_DATA_FS_MAX_PACKET_SIZE)
+  {
+    htmc->OutLeft = 0U;         /* a short packet ends the transfer */
+  }
+
+  TMC_Fops->Receive(pbuf, n, (htmc->OutLeft == 0U) ? htmc->OutEom : 0U);
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_TMC_RegisterInterface
+  * @param  pdev: device instance
+  * @param  fops: Interface callbacks
+  * @retval status
+  */
+uint8_t  USBD_TMC_RegisterInterface(USBD_HandleTypeDef   *pdev,
+                                    USBD_TMC_ItfTypeDef *fops)
+{
+  uint8_t  ret = USBD_FAIL;
+
+  UNUSED(pdev);
+
+  if (fops != NULL)
+  {
+    TMC_Fops = fops;
+    ret = USBD_OK;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  USBD_TMC_ReceivePacket
+  *         prepare OUT Endpoint for reception
+  * @param  pdev: device instance
+  * @retval status
+  */
+uint8_t  USBD_TMC_ReceivePacket(USBD_HandleTypeDef *pdev)
+{
+  if (pdev->dev_state != USBD_STATE_CONFIGURED)
+  {
+    return USBD_FAIL;
+  }
+
+  /* Prepare Out endpoint to receive next packet */
+  USBD_LL_PrepareReceive(pdev, TMC_OUT_EP, (uint8_t *)(void *)TMC_Handle.RxBuffer,
+                         TMC_DATA_FS_MAX_PACKET_SIZE);
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_TMC_Requested
+  *         Size of the response the host waits for
+  * @param  pdev: device instance
+  * @retval TransferSize of the REQUEST_DEV_DEP_MSG_IN not yet answered, 0 if none
+  */
+uint32_t USBD_TMC_Requested(USBD_HandleTypeDef *pdev)
+{
+  UNUSED(pdev);
+
+  return (TMC_Handle.InState == TMC_IN_REQUESTED) ? TMC_Handle.InMax : 0U;
+}
+
+/**
+  * @brief  USBD_TMC_Transmit
+  *         Answer the REQUEST_DEV_DEP_MSG_IN with one DEV_DEP_MSG_IN transfer
+  * @param  pdev: device instance
+  * @param  pbuff: TMC_HEADER_SIZE bytes for the header, the message bytes,
+  *                room for up to 3 alignment bytes
+  * @param  length: Number of message bytes, at most USBD_TMC_Requested()
+  * @param  eom: the message ends with them
+  * @retval status, USBD_BUSY while the transfer before is still armed
+  */
+uint8_t  USBD_TMC_Transmit(USBD_HandleTypeDef *pdev,
+                           uint8_t *pbuff,
+                           uint32_t length,
+                           uint8_t eom)
+{
+  USBD_TMC_HandleTypeDef *htmc = &TMC_Handle;
+  uint32_t total = TMC_HEADER_SIZE + length;
+
+  if ((htmc->InState != TMC_IN_REQUESTED) || (htmc->InBusy != 0U))
+  {
+    return USBD_BUSY;
+  }
+
+  pbuff[0] = TMC_DEV_DEP_MSG_IN;
+  pbuff[1] = htmc->InTag;
+  pbuff[2] = (uint8_t)~htmc->InTag;
+  pbuff[3] = 0U;
+  TMC_PUT32(&pbuff[4], length);
+  pbuff[8] = eom ? TMC_ATTR_EOM : 0U;
+  pbuff[9] = pbuff[10] = pbuff[11] = 0U;
+
+  while ((total & 3U) != 0U)
+  {
+    pbuff[total++] = 0U;
+  }
+
+  /* Tx Transfer in progress */
+  htmc->InState = TMC_IN_RUNNING;
+  htmc->InBusy = 1U;
+  htmc->InSent = length;
+
+  /* Update the packet total length */
+  pdev->ep_in[TMC_IN_EP & 0xFU].total_length = total;
+
+  USBD_LL_Transmit(pdev, TMC_IN_EP, pbuff, (uint16_t)total);
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_TMC_Notify
+  *         Send a USB488 notification on the Interrupt IN endpoint
+  * @param  pdev: device instance
+  * @param  notify1: bNotify1, TMC_NOTIFY_xxx
+  * @param  notify2: bNotify2, the status byte
+  * @retval status
+  */
+uint8_t  USBD_TMC_Notify(USBD_HandleTypeDef *pdev,
+                         uint8_t notify1,
+                         uint8_t notify2)
+{
+  USBD_TMC_HandleTypeDef *htmc = &TMC_Handle;
+
+  if (pdev->dev_state != USBD_STATE_CONFIGURED)
+  {
+    return USBD_FAIL;
+  }
+
+  if (htmc->IntState != 0U)
+  {
+    return USBD_BUSY;
+  }
+
+  htmc->Notify[0] = notify1;
+  htmc->Notify[1] = notify2;
+  htmc->IntState = 1U;
+
+  USBD_LL_Transmit(pdev, TMC_INT_EP, htmc->Notify, TMC_INT_PACKET_SIZE);
+
+  return USBD_OK;
+}
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
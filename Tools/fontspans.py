@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+#
+# fontspans.py
+#
+#  Created on: 19.10.2026
+#      Author: aziemer
+#
+# Converts an Adafruit GFX font header into run-length encoded glyph rows,
+# as used by the span renderer in tft.c.
+#
+# Usage: fontspans.py <font header> [output header]
+#
+# Format of <name>Spans[], per glyph and per bitmap row:
+#
+#   n, run[0], run[1], ... run[n-1]
+#
+# The runs alternate between background and foreground pixels, starting with
+# background (which may have a length of 0). The runs of a row always add up to
+# the glyph width. <name>SpanOffsets[] holds the start of each glyph in <name>Spans[].
+#
+# <name>Advances[] and <name>Metrics hold the font metrics (see GFXmetrics in
+# gfxfont.h), so the renderer does not have to scan the glyph table at run-time.
+#
+
+import os
+import re
+import sys
+
+
+def parse_font( text ):
+	bitmaps = re.search( r'const\s+uint8_t\s+(\w+)Bitmaps\s*\[\]\s*(?:PROGMEM\s*)?=\s*\{([^}]*)\}', text )
+	glyphs = re.search( r'const\s+GFXglyph\s+\w+\s*\[\]\s*(?:PROGMEM\s*)?=\s*\{(.*?)\}\s*;', text, re.S )
+	font = re.search( r'const\s+GFXfont\s+(\w+)\s*=\s*\{([^}]*)\}', text )
+
+	if not bitmaps or not glyphs or not font:
+		raise ValueError( 'not a GFX font header with glyph table' )
+
+	data = [ int( v, 0 ) for v in re.findall( r'0x[0-9A-Fa-f]+|\d+', bitmaps.group( 2 ) ) ]
+	glyph_list = [ [ int( v ) for v in g.split( ',' ) ] for g in re.findall( r'\{([^{}]*)\}', glyphs.group( 1 ) ) ]
+	fields = [ f.strip() for f in font.group( 2 ).split( ',' ) ]
+
+	return font.group( 1 ), data, glyph_list, int( fields[2], 0 ), int( fields[3], 0 )
+
+
+def glyph_rows( data, glyph ):
+	offset, width, height = glyph[0], glyph[1], glyph[2]
+	bit = 0
+
+	for y in range( height ):
+		row = []
+		for x in range( width ):
+			byte = data[ offset + bit // 8 ]
+			row.append( ( byte >> ( 7 - bit % 8 ) ) & 1 )
+			bit += 1
+		yield row
+
+
+def encode_row( row ):
+	runs = []
+	current, length = 0, 0				# start with a background run
+
+	for pixel in row:
+		if pixel != current:
+			runs.append( length )
+			current, length = pixel, 0
+		length += 1
+
+	if length:
+		runs.append( length )
+
+	return [ len( runs ) ] + runs
+
+
+def write_array( out, ctype, name, values, comment = '' ):
+	out.write( 'const %s %s[] = {%s\n' % ( ctype, name, comment ) )
+	for i in range( 0, len( values ), 16 ):
+		out.write( '\t' + ', '.join( '%d' % v for v in values[i:i+16] ) + ',\n' )
+	out.write( '};\n\n' )
+
+
+def main():
+	if len( sys.argv ) < 2:
+		sys.stderr.write( 'usage: %s <font header> [output header]\n' % sys.argv[0] )
+		return 1
+
+	src = sys.argv[1]
+	name, data, glyphs, first, last = parse_font( open( src ).read() )
+
+	ascent = min( g[5] for g in glyphs )
+	descent = max( g[5] + g[2] for g in glyphs )
+	advances = [ g[3] for g in glyphs ]
+
+	spans, offsets = [], []
+	for glyph in glyphs:
+		offsets.append( len( spans ) )
+		for row in glyph_rows( data, glyph ):
+			spans += encode_row( row )
+
+	dst = sys.argv[2] if len( sys.argv ) > 2 else os.path.join( os.path.dirname( src ), name + '_render.h' )
+	guard = '__%s_RENDER_H_' % name.upper()
+
+	with open( dst, 'w' ) as out:
+		out.write( '// Generated by Tools/fontspans.py from %s - do not edit\n\n' % os.path.basename( src ) )
+		out.write( '#ifndef %s\n#define %s\n\n' % ( guard, guard ) )
+		out.write( '#include "gfxfont.h"\n\n' )
+		write_array( out, 'uint8_t', name + 'Spans', spans )
+		write_array( out, 'uint16_t', name + 'SpanOffsets', offsets, '\t\t// 0x%02X .. 0x%02X' % ( first, last ) )
+		write_array( out, 'uint8_t', name + 'Advances', advances, '\t\t// 0x%02X .. 0x%02X' % ( first, last ) )
+		out.write( 'const GFXmetrics %sMetrics = {\n\t%d, %d, %d, %d, %sAdvances\n};\n\n'
+			% ( name, ascent, descent, descent - ascent + 1, max( advances ), name ) )
+		out.write( '// Approx. %d bytes\n\n' % ( len( spans ) + 2 * len( offsets ) + len( advances ) + 8 ) )
+		out.write( '#endif /* %s */\n' % guard )
+
+	return 0
+
+
+if __name__ == '__main__':
+	sys.exit( main() )
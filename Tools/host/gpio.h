@@ -0,0 +1,12 @@
+/*
+ * gpio.h
+ *
+ *  Host stand-in for Core/Inc/gpio.h, see main.h.
+ */
+
+#ifndef TOOLS_HOST_GPIO_H_
+#define TOOLS_HOST_GPIO_H_
+
+#include "main.h"
+
+#endif /* TOOLS_HOST_GPIO_H_ */
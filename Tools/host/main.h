@@ -0,0 +1,77 @@
+/*
+ * main.h
+ *
+ *  Created on: 19.10.2026
+ *      Author: aziemer
+ *
+ *  Host stand-in for Core/Inc/main.h, used by the host tools in Tools/ only:
+ *  the GPIO ports are plain memory, HAL_GetTick() is the host's millisecond clock.
+ */
+
+#ifndef TOOLS_HOST_MAIN_H_
+#define TOOLS_HOST_MAIN_H_
+
+#include <stdint.h>
+#include <time.h>
+
+typedef struct
+{
+	volatile uint32_t CRL, CRH, IDR, ODR, BSRR, BRR, LCKR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+	uint32_t Pin, Mode, Pull, Speed;
+} GPIO_InitTypeDef;
+
+typedef enum { GPIO_PIN_RESET = 0, GPIO_PIN_SET } GPIO_PinState;
+
+extern GPIO_TypeDef host_gpio[2];
+extern uint32_t SystemCoreClock;
+
+#define GPIOA					( &host_gpio[0] )
+#define GPIOB					( &host_gpio[1] )
+
+#define GPIO_PIN_0				0x0001U
+#define GPIO_PIN_1				0x0002U
+#define GPIO_PIN_2				0x0004U
+#define GPIO_PIN_10				0x0400U
+#define GPIO_PIN_13				0x2000U
+#define GPIO_NOPULL				0
+#define GPIO_SPEED_FREQ_HIGH	0
+#define GPIO_MODE_OUTPUT_PP		0
+
+#define LCD_D0_Pin				GPIO_PIN_0
+#define LCD_D0_GPIO_Port		GPIOA
+#define LCD_CS_Pin				GPIO_PIN_1
+#define LCD_CS_GPIO_Port		GPIOB
+#define LCD_RS_Pin				GPIO_PIN_2
+#define LCD_RS_GPIO_Port		GPIOB
+#define LCD_WR_Pin				GPIO_PIN_10
+#define LCD_WR_GPIO_Port		GPIOB
+#define BACKLIGHT_Pin			GPIO_PIN_13
+#define BACKLIGHT_GPIO_Port		GPIOA
+
+static inline void HAL_GPIO_WritePin( GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state )
+{
+	if( state == GPIO_PIN_SET )
+		port->BSRR = pin;
+	else
+		port->BRR = pin;
+}
+
+static inline void HAL_GPIO_Init( GPIO_TypeDef *port, GPIO_InitTypeDef *init )
+{
+	(void)port;
+	(void)init;
+}
+
+static inline uint32_t HAL_GetTick( void )
+{
+	struct timespec t;
+
+	clock_gettime( CLOCK_MONOTONIC, &t );
+	return t.tv_sec * 1000U + t.tv_nsec / 1000000U;
+}
+
+#endif /* TOOLS_HOST_MAIN_H_ */
@@ -0,0 +1,37 @@
+/*
+ * rtc.h
+ *
+ *  Host stand-in for Core/Inc/rtc.h, see main.h: the HAL functions are up to the host tool.
+ */
+
+#ifndef TOOLS_HOST_RTC_H_
+#define TOOLS_HOST_RTC_H_
+
+#include "main.h"
+
+typedef struct
+{
+	uint8_t Hours, Minutes, Seconds;
+} RTC_TimeTypeDef;
+
+typedef struct
+{
+	uint8_t WeekDay, Month, Date, Year;
+} RTC_DateTypeDef;
+
+typedef struct
+{
+	int dummy;
+} RTC_HandleTypeDef;
+
+#define RTC_FORMAT_BIN			0
+#define RTC_WEEKDAY_MONDAY		1
+
+extern RTC_HandleTypeDef hrtc;
+
+int HAL_RTC_GetTime( RTC_HandleTypeDef *hrtc, RTC_TimeTypeDef *sTime, uint32_t format );
+int HAL_RTC_GetDate( RTC_HandleTypeDef *hrtc, RTC_DateTypeDef *sDate, uint32_t format );
+int HAL_RTC_SetTime( RTC_HandleTypeDef *hrtc, RTC_TimeTypeDef *sTime, uint32_t format );
+int HAL_RTC_SetDate( RTC_HandleTypeDef *hrtc, RTC_DateTypeDef *sDate, uint32_t format );
+
+#endif /* TOOLS_HOST_RTC_H_ */
@@ -0,0 +1,38 @@
+/*
+ * usart.h
+ *
+ *  Host stand-in for Core/Inc/usart.h, see main.h: the handle only has what scpi.c looks at,
+ *  the HAL functions are up to the host tool.
+ */
+
+#ifndef TOOLS_HOST_USART_H_
+#define TOOLS_HOST_USART_H_
+
+#include "main.h"
+
+typedef struct
+{
+	volatile uint32_t CNDTR;
+} DMA_Channel_TypeDef;
+
+typedef struct
+{
+	DMA_Channel_TypeDef *Instance;
+} DMA_HandleTypeDef;
+
+typedef enum { HAL_UART_STATE_READY = 0x20U, HAL_UART_STATE_BUSY_RX = 0x22U } HAL_UART_StateTypeDef;
+
+typedef struct
+{
+	DMA_HandleTypeDef *hdmarx;
+	HAL_UART_StateTypeDef RxState;
+} UART_HandleTypeDef;
+
+#define __HAL_DMA_GET_COUNTER( h )	( (h)->Instance->CNDTR )
+
+extern UART_HandleTypeDef huart1;
+
+int HAL_UART_Transmit_DMA( UART_HandleTypeDef *huart, uint8_t *data, uint16_t size );
+int HAL_UARTEx_ReceiveToIdle_DMA( UART_HandleTypeDef *huart, uint8_t *data, uint16_t size );
+
+#endif /* TOOLS_HOST_USART_H_ */
@@ -0,0 +1,37 @@
+/*
+ * usbd_conf.h
+ *
+ *  Host stand-in for USB_DEVICE/Target/usbd_conf.h, see main.h: no HAL, the USBD_LL_xxx
+ *  functions are up to the host tool.
+ */
+
+#ifndef TOOLS_HOST_USBD_CONF_H_
+#define TOOLS_HOST_USBD_CONF_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "main.h"
+
+#define USBD_MAX_NUM_INTERFACES		3
+#define USBD_MAX_NUM_CONFIGURATION	1
+#define USBD_MAX_STR_DESC_SIZ		512
+#define USBD_DEBUG_LEVEL			0
+#define USBD_SELF_POWERED			1
+
+#define USBD_UsrLog(...)
+#define USBD_ErrLog(...)
+#define USBD_DbgLog(...)
+
+#ifndef __IO
+#define __IO						volatile
+#endif
+#ifndef UNUSED
+#define UNUSED(x)					((void)(x))
+#endif
+
+static inline void __disable_irq( void ) { }	// single threaded, "interrupts" are calls
+static inline void __enable_irq( void ) { }
+
+#endif /* TOOLS_HOST_USBD_CONF_H_ */
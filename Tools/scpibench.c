@@ -0,0 +1,175 @@
+/*
+ * scpibench.c
+ *
+ *  Created on: 19.10.2026
+ *      Author: aziemer
+ *
+ *  Host benchmark of SCPI_Match() against the former linear keyword search,
+ *  build and run with "make scpibench".
+ *
+ *  Commands are split into keywords at ':' ';' ' ' and '?' like SCPI_Execute() does, every
+ *  keyword is matched. Also checks that both matchers agree on the short and long forms.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+
+#include "scpikw.h"
+
+static int LinearMatch( char *keyword )		// SCPI_Match() before the perfect hash
+{
+	uint8_t i;
+
+	for( i = 0; i < SCPI_NUM_STRINGS; ++i )
+	{
+		const uint8_t *pattern;
+		uint8_t *cmd = (uint8_t*)keyword;
+
+		for( pattern = (const uint8_t*)scpi_keywords[i]; *pattern; ++pattern )
+		{
+			uint8_t ch = toupper( *cmd );
+
+			if( *pattern == ' ' )
+			{
+				if( !*cmd || !isspace( *cmd ) )
+					break;
+
+				while( *cmd && isspace( *cmd ) )
+					++cmd;
+			}
+			else if( isupper( *pattern ) || *pattern == '*' )
+			{
+				if( ch != *pattern )
+					break;
+				++cmd;
+			}
+			else if( toupper( *pattern ) == ch )
+			{
+				++cmd;
+			}
+			else if( isalpha( ch ) )
+			{
+				const uint8_t *p = pattern;
+				while( *p && islower( *p ) )
+					++p;
+
+				if( ch != *p )
+					break;
+				++cmd;
+			}
+		}
+
+		if( !*pattern )
+			return i;
+	}
+
+	return -1;
+}
+
+static const char * const commands[] = {
+	"CONF:VOLT:DC 10;READ?",
+	"MEAS:VOLT:DC?",
+	"SENS:FUNC CURR:AC",
+	"CALC:NULL:STAT ON",
+	"SYST:TIME?",
+	"CONFigure:RESistance AUTO",
+	"*IDN?",
+	"SENSe:TEMPerature:RTD:TYPe?",
+	"CALCulate:AVERage:ALL?",
+	"SYSTem:DISPlay:FRAMe?"
+};
+
+#define NUM_COMMANDS	( sizeof( commands ) / sizeof( commands[0] ) )
+
+static int Execute( const char *command, int (*match)( char * ) )		// sum of the keyword indices
+{
+	char buf[100], *p, *kw;
+	int sum = 0;
+
+	strcpy( buf, command );
+
+	for( p = buf; *p; )
+	{
+		kw = p;
+		while( *p && !strchr( ":; ?", *p ) )
+			++p;
+		if( *p )
+			*p++ = '\0';
+		if( *kw && !isdigit( (uint8_t)*kw ) )
+			sum += match( kw );
+	}
+
+	return sum;
+}
+
+static int HashMatch( char *keyword )
+{
+	return SCPI_Match( keyword );
+}
+
+static double Bench( const char *name, int (*match)( char * ), long rounds )
+{
+	struct timespec t0, t1;
+	volatile int sink = 0;
+	double s;
+	long r;
+	size_t c;
+
+	clock_gettime( CLOCK_MONOTONIC, &t0 );
+	for( r = 0; r < rounds; ++r )
+		for( c = 0; c < NUM_COMMANDS; ++c )
+			sink += Execute( commands[c], match );
+	clock_gettime( CLOCK_MONOTONIC, &t1 );
+
+	s = ( t1.tv_sec - t0.tv_sec ) + ( t1.tv_nsec - t0.tv_nsec ) * 1e-9;
+	printf( "%-8s %10.0f commands/s\n", name, rounds * NUM_COMMANDS / s );
+	return s;
+}
+
+static int Check( void )		// both matchers on every keyword's short and long form
+{
+	char form[40];
+	int errors = 0, i;
+	size_t n;
+
+	for( i = 0; i < SCPI_NUM_STRINGS; ++i )
+	{
+		const char *kw = scpi_keywords[i];
+		int longForm;
+
+		for( longForm = 0; longForm < 2; ++longForm )
+		{
+			for( n = 0; *kw; ++kw )
+				if( longForm || !islower( (uint8_t)*kw ) )
+					form[n++] = toupper( (uint8_t)*kw );
+			form[n] = '\0';
+			kw = scpi_keywords[i];
+
+			if( SCPI_Match( form ) != i || LinearMatch( form ) != i )
+			{
+				printf( "%-20s hash %d linear %d, expected %d\n", form, SCPI_Match( form ), LinearMatch( form ), i );
+				++errors;
+			}
+		}
+	}
+
+	return errors;
+}
+
+int main( void )
+{
+	long rounds = 200000;
+	double linear, hash;
+
+	if( Check() )
+		printf( "(the linear search never matched short forms past a lower case run)\n" );
+
+	linear = Bench( "linear", LinearMatch, rounds );
+	hash = Bench( "hash", HashMatch, rounds );
+	printf( "speedup  %10.1f\n", linear / hash );
+
+	return 0;
+}
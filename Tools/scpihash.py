@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+#
+# scpihash.py
+#
+#  Created on: 19.10.2026
+#      Author: aziemer
+#
+# Generates the perfect hash used by SCPI_Match() in scpikw.c.
+#
+# Usage: scpihash.py <scpikw.c> [output header]
+#
+# Every form a keyword accepts (each lower case run of it in full or left out,
+# upper cased) is hashed with FNV-1a over the case folded characters (c & 0xDF):
+#
+#   bucket = h & ( SCPI_HASH_BUCKETS - 1 )
+#   slot   = ( ( h >> 8 ) ^ scpi_hash_disp[bucket] ) & ( SCPI_HASH_SLOTS - 1 )
+#
+# scpi_hash_slot[slot] is the keyword index, 0xFF for an unused slot. The
+# displacements are searched bucket by bucket, largest first, so no two forms
+# share a slot; if that fails, the next hash basis is tried.
+#
+
+import itertools
+import os
+import re
+import sys
+
+BUCKETS = 64
+SLOTS = 256
+FNV_BASIS = 2166136261
+FNV_PRIME = 16777619
+
+
+def parse_keywords( text ):
+	table = re.search( r'const\s+char\s*\*\s*const\s+scpi_keywords\s*\[\]\s*=\s*\{(.*?)\}\s*;', text, re.S )
+	if not table:
+		raise ValueError( 'no scpi_keywords[] table' )
+	return re.findall( r'"([^"]*)"', table.group( 1 ) )
+
+
+def forms( pattern ):
+	parts = re.findall( r'[a-z]+|[^a-z]+', pattern )
+	runs = [ i for i, p in enumerate( parts ) if p.islower() ]
+
+	for take in itertools.product( ( False, True ), repeat = len( runs ) ):
+		keep = dict( zip( runs, take ) )
+		yield ''.join( p for i, p in enumerate( parts ) if keep.get( i, True ) ).upper()
+
+
+def fnv( text, basis ):
+	h = basis
+	for c in text.encode():
+		h = ( ( h ^ ( c & 0xDF ) ) * FNV_PRIME ) & 0xFFFFFFFF
+	return h
+
+
+def place( hashes, basis ):
+	buckets = [ [] for _ in range( BUCKETS ) ]
+	for h, kw in hashes:
+		buckets[ h & ( BUCKETS - 1 ) ].append( ( h, kw ) )
+
+	disp = [ 0 ] * BUCKETS
+	slot = [ 0xFF ] * SLOTS
+
+	for b in sorted( range( BUCKETS ), key = lambda b: -len( buckets[b] ) ):
+		for d in range( 256 ):
+			taken = [ ( ( h >> 8 ) ^ d ) & ( SLOTS - 1 ) for h, kw in buckets[b] ]
+			if len( set( taken ) ) == len( taken ) and all( slot[s] == 0xFF for s in taken ):
+				break
+		else:
+			return None
+
+		disp[b] = d
+		for s, ( h, kw ) in zip( taken, buckets[b] ):
+			slot[s] = kw
+
+	return disp, slot
+
+
+def write_array( out, ctype, name, values, comment = '' ):
+	out.write( 'const %s %s[] = {%s\n' % ( ctype, name, comment ) )
+	for i in range( 0, len( values ), 16 ):
+		out.write( '\t' + ', '.join( '%d' % v for v in values[i:i+16] ) + ',\n' )
+	out.write( '};\n\n' )
+
+
+def main():
+	if len( sys.argv ) < 2:
+		sys.stderr.write( 'usage: %s <scpikw.c> [output header]\n' % sys.argv[0] )
+		return 1
+
+	src = sys.argv[1]
+	keywords = parse_keywords( open( src ).read() )
+	if len( keywords ) >= 0xFF:
+		raise ValueError( 'too many keywords' )
+
+	owner = {}
+	for kw, pattern in enumerate( keywords ):
+		for form in forms( pattern ):
+			if form in owner and owner[form] != kw:
+				raise ValueError( '%s is a form of both %s and %s' % ( form, keywords[ owner[form] ], pattern ) )
+			owner[form] = kw
+
+	for basis in range( FNV_BASIS, FNV_BASIS + 100000 ):
+		result = place( [ ( fnv( f, basis ), kw ) for f, kw in owner.items() ], basis )
+		if result:
+			break
+	else:
+		raise ValueError( 'no perfect hash found' )
+
+	disp, slot = result
+
+	dst = sys.argv[2] if len( sys.argv ) > 2 else os.path.join( os.path.dirname( src ), '..', 'Inc', 'scpi_hash.h' )
+	with open( dst, 'w' ) as out:
+		out.write( '// Generated by Tools/scpihash.py from %s - do not edit\n\n' % os.path.basename( src ) )
+		out.write( '#ifndef __SCPI_HASH_H_\n#define __SCPI_HASH_H_\n\n' )
+		out.write( '// %d keywords, %d forms\n\n' % ( len( keywords ), len( owner ) ) )
+		out.write( '#define SCPI_HASH_BASIS\t\t%uUL\n' % basis )
+		out.write( '#define SCPI_HASH_PRIME\t\t%uUL\n' % FNV_PRIME )
+		out.write( '#define SCPI_HASH_BUCKETS\t%d\n' % BUCKETS )
+		out.write( '#define SCPI_HASH_SLOTS\t\t%d\n\n' % SLOTS )
+		write_array( out, 'uint8_t', 'scpi_hash_disp', disp )
+		write_array( out, 'uint8_t', 'scpi_hash_slot', slot )
+		out.write( '#endif /* __SCPI_HASH_H_ */\n' )
+
+	return 0
+
+
+if __name__ == '__main__':
+	sys.exit( main() )
@@ -0,0 +1,185 @@
+/*
+ * scpitest.c
+ *
+ *  Created on: 19.10.2026
+ *      Author: aziemer
+ *
+ *  Host test of the SCPI session handling in scpi.c with the trigger of trig.c, build and run
+ *  with "make scpitest", exits with 1 if a check fails.
+ *
+ *  The commands go through Do_SCPI() on the USB (CDC) session, a byte stream without a device
+ *  clear. Readings are fed to TRIG_Reading() like the acquisition task does; everything else
+ *  scpi.c calls is a stub.
+ */
+
+#include "../Core/Src/scpi.c"
+
+#define CHECK( c )	Check( ( c ) != 0, #c, __LINE__ )
+
+GPIO_TypeDef host_gpio[2];
+uint32_t SystemCoreClock = 72000000;
+RTC_HandleTypeDef hrtc;
+static DMA_Channel_TypeDef dma_rx = { UART_RX_SIZE };	// nothing received
+static DMA_HandleTypeDef hdma_rx = { &dma_rx };
+UART_HandleTypeDef huart1 = { &hdma_rx, HAL_UART_STATE_BUSY_RX };
+const DMMCFG dmmcfg[SCALE_DIODE + 1];
+
+static const char *input = "";		// what the host sends on the CDC session
+static char output[1024];			// what it got back
+static uint16_t outlen;
+
+static unsigned checks, failed;
+
+static void Check( int ok, const char *what, int line )
+{
+	++checks;
+	if( !ok )
+	{
+		++failed;
+		printf( "scpitest.c:%d: check failed: %s\n", line, what );
+	}
+}
+
+/* transports ---------------------------------------------------------------- */
+
+int CDC_Getc( void )
+{
+	return *input ? (uint8_t)*input++ : -1;
+}
+
+uint16_t CDC_Write( const uint8_t *buf, uint16_t len )
+{
+	if( len > sizeof(output) - 1 - outlen )
+		len = sizeof(output) - 1 - outlen;
+	memcpy( output + outlen, buf, len );
+	outlen += len;
+	output[outlen] = 0;
+	return len;
+}
+
+uint16_t CDC_WriteFree( void )
+{
+	return sizeof(output) - 1 - outlen;
+}
+
+int TMC_Getc( void ) { return -1; }
+uint16_t TMC_Write( const uint8_t *buf, uint16_t len ) { (void)buf; return len; }
+uint16_t TMC_WriteFree( void ) { return 512; }
+void TMC_End( void ) { }
+uint8_t TMC_Clear( void ) { return 0; }
+void TMC_Status( uint8_t stb ) { (void)stb; }
+
+int HAL_UART_Transmit_DMA( UART_HandleTypeDef *huart, uint8_t *data, uint16_t size ) { (void)huart; (void)data; (void)size; return 0; }
+int HAL_UARTEx_ReceiveToIdle_DMA( UART_HandleTypeDef *huart, uint8_t *data, uint16_t size ) { (void)huart; (void)data; (void)size; return 0; }
+
+/* the rest of the firmware ---------------------------------------------------- */
+
+int HAL_RTC_GetTime( RTC_HandleTypeDef *h, RTC_TimeTypeDef *t, uint32_t f ) { (void)h; (void)f; memset( t, 0, sizeof(*t) ); return 0; }
+int HAL_RTC_GetDate( RTC_HandleTypeDef *h, RTC_DateTypeDef *d, uint32_t f ) { (void)h; (void)f; memset( d, 0, sizeof(*d) ); return 0; }
+int HAL_RTC_SetTime( RTC_HandleTypeDef *h, RTC_TimeTypeDef *t, uint32_t f ) { (void)h; (void)t; (void)f; return 0; }
+int HAL_RTC_SetDate( RTC_HandleTypeDef *h, RTC_DateTypeDef *d, uint32_t f ) { (void)h; (void)d; (void)f; return 0; }
+
+void SCHED_Signal( uint8_t task ) { (void)task; }
+const TASK *SCHED_GetTask( uint8_t task ) { (void)task; return NULL; }
+const TASK_STATS *SCHED_GetStats( uint8_t task ) { (void)task; return NULL; }
+void SCHED_ResetStats( void ) { }
+
+uint8_t CALIB_Start( uint8_t point, double ref ) { (void)point; (void)ref; return 0; }
+uint8_t CALIB_Busy( void ) { return 0; }
+
+void DMM_Init( void ) { }
+int DMM_GetScale( uint8_t ch ) { (void)ch; return 0; }
+int DMM_FindScale( int mode, double range ) { (void)mode; (void)range; return 0; }
+int DMM_GetMode( int scale ) { (void)scale; return 0; }
+const DMMDISP *DMM_GetDisplay( int scale ) { (void)scale; return NULL; }
+
+void SetAuto( int mode ) { (void)mode; }
+void SetScale( uint8_t channel, int scale ) { (void)channel; (void)scale; }
+void RedrawScreen( void ) { }
+void ClockChanged( void ) { }
+void SetRemote( uint8_t on ) { (void)on; }
+const FRAME_STATS *GetFrameStats( void ) { return NULL; }
+void ResetFrameStats( void ) { }
+void SetFrameRate( int hz ) { (void)hz; }
+uint8_t GetFrameRate( void ) { return 0; }
+void SetDisplayFilter( uint8_t on ) { (void)on; }
+uint8_t GetDisplayFilter( void ) { return 0; }
+uint32_t GetReadings( void ) { return 0; }
+
+/* the host side --------------------------------------------------------------- */
+
+static void Run( const char *text )		// send text, let Do_SCPI() work through it
+{
+	int i;
+
+	input = text;
+	outlen = 0;
+	output[0] = 0;
+	for( i = 0; i < 50; ++i )
+		Do_SCPI();
+}
+
+static void Readings( int n )			// the acquisition task: n readings of 1.5
+{
+	int i;
+
+	for( i = 0; i < n; ++i )
+	{
+		TRIG_Reading( 1.5 );
+		Do_SCPI();
+	}
+	for( i = 0; i < 50; ++i )
+		Do_SCPI();
+}
+
+/* the tests --------------------------------------------------------------- */
+
+static void TestBusTrigger( void )		// FETC? must not keep the *TRG it waits for from running
+{
+	Run( "TRIG:SOUR BUS;:INIT\nFETC?\n*TRG\n" );
+	CHECK( outlen == 0 );				// triggered, the capture runs
+	Readings( 2 );						// the first one started before the trigger
+	CHECK( strcmp( output, "+1.500000e+00\n" ) == 0 );
+	CHECK( !TRIG_Busy() );
+
+	Run( "INIT\nFETC?;*TRG\n" );		// in the same line
+	Readings( 2 );
+	CHECK( strcmp( output, "+1.500000e+00\n" ) == 0 );
+
+	Run( "INIT\nFETC?\n*TRG\n*ESR?\n" );	// anything else still waits behind the readings
+	CHECK( outlen == 0 );
+	Readings( 2 );
+	CHECK( strcmp( output, "+1.500000e+00\n0\n" ) == 0 );	// readings, then *ESR?
+
+	Run( "INIT\nFETC?\nABOR\n" );		// ends the capture, no readings
+	CHECK( strcmp( output, "\n" ) == 0 );
+	CHECK( !TRIG_Busy() );
+}
+
+static void TestRead( void )			// READ? with TRIG:SOUR BUS is always answered
+{
+	Run( "*CLS\nTRIG:SOUR BUS\nREAD?\n" );
+	CHECK( strcmp( output, "\n" ) == 0 );
+	CHECK( !TRIG_Busy() );
+	Run( "*ESR?\n" );
+	CHECK( atoi( output ) & ESR_EXE );
+
+	Run( "FORM:DATA REAL\nREAD?\n" );
+	CHECK( strcmp( output, "#10\n" ) == 0 );
+	Run( "FORM:DATA INT\nREAD?\n" );
+	CHECK( strcmp( output, "+1.000000e+00,#10\n" ) == 0 );	// the factor, no readings
+
+	Run( "FORM:DATA ASC\nTRIG:SOUR IMM\nREAD?\n" );	// the immediate trigger still captures
+	CHECK( outlen == 0 );
+	Readings( 2 );
+	CHECK( strcmp( output, "+1.500000e+00\n" ) == 0 );
+}
+
+int main( void )
+{
+	TestBusTrigger();
+	TestRead();
+
+	printf( "scpitest: %u checks, %u failed\n", checks, failed );
+	return failed ? 1 : 0;
+}
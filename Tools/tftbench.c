@@ -0,0 +1,89 @@
+/*
+ * tftbench.c
+ *
+ *  Created on: 19.10.2026
+ *      Author: aziemer
+ *
+ *  Host benchmark of the glyph renderers in tft.c and of NUM_Format() against sprintf(),
+ *  build and run with "make tftbench".
+ *
+ *  tft.c is compiled against the stand-ins in Tools/host, so every display bus access is a
+ *  store to memory. The figures show the CPU side of the renderers only; on the target the
+ *  GPIO writes and the WR strobes are slower, the ratio between the two paths is what counts.
+ */
+
+#include "../Core/Src/tft.c"
+
+GPIO_TypeDef host_gpio[2];
+
+static void Fonts( const char *title, uint16_t fg, uint16_t bg )
+{
+	static const uint8_t fonts[] = { FONT_10X16, FONT_16X24, FONT_32X50 };
+	uint32_t bitmap, spans, bytes;
+	uint8_t i;
+
+	printf( "%s\n", title );
+	TFT_setForeGround( fg );
+	TFT_setBackGround( bg );
+
+	for( i = 0; i < sizeof(fonts); ++i )
+	{
+		tft_use_spans = 0;
+		bitmap = benchmarkFont( fonts[i] );
+		tft_use_spans = 1;
+		spans = benchmarkFont( fonts[i] );
+
+		bytes = tft_busBytes;
+		drawChar( '8' );
+		bytes = tft_busBytes - bytes;
+
+		printf( "  font %d: bitmap %8lu, spans %8lu glyphs/s (x%.1f), %5lu bus bytes per '8'\n",
+			fonts[i], (unsigned long)bitmap, (unsigned long)spans, (double)spans / bitmap, (unsigned long)bytes );
+	}
+}
+
+static double Seconds( void )
+{
+	struct timespec t;
+
+	clock_gettime( CLOCK_MONOTONIC, &t );
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static void Numbers( void )		// like NUM_Benchmark(), but without a clock read per conversion
+{
+	static const NUMFMT fmt = { 7, 3, NUM_SIGN };
+	const long rounds = 2000000;
+	volatile char sink;
+	char str[20];
+	double t, val;
+	long n;
+
+	t = Seconds();
+	for( n = 0, val = -12.3456; n < rounds; ++n, val += 0.001 )
+	{
+		sprintf( str, "%+7.3f", val );
+		sink = str[3];
+	}
+	t = Seconds() - t;
+	printf( "%%+7.3f: sprintf    %9.0f conversions/s\n", rounds / t );
+
+	t = Seconds();
+	for( n = 0, val = -12.3456; n < rounds; ++n, val += 0.001 )
+	{
+		NUM_Format( str, val, &fmt );
+		sink = str[3];
+	}
+	t = Seconds() - t;
+	printf( "%%+7.3f: NUM_Format %9.0f conversions/s\n", rounds / t );
+	(void)sink;
+}
+
+int main( void )
+{
+	Fonts( "white on black (both colour bytes equal)", VGA_WHITE, VGA_BLACK );
+	Fonts( "yellow on navy", VGA_YELLOW, VGA_NAVY );
+
+	Numbers();
+	return 0;
+}
@@ -0,0 +1,497 @@
+/*
+ * tmctest.c
+ *
+ *  Created on: 19.10.2026
+ *      Author: aziemer
+ *
+ *  Host test of the USBTMC class (usbd_usbtmc.c) with its interface (usbd_usbtmc_if.c),
+ *  build and run with "make tmctest", exits with 1 if a check fails.
+ *
+ *  The USBD_LL_xxx functions are stubs: the test plays the host, one Bulk-OUT packet per
+ *  DataOut(), Bulk-IN packets read one by one with DataIn() once a transfer is complete,
+ *  like the HAL does; class requests go through Setup(). The session side is TMC_Getc(),
+ *  TMC_Write() and TMC_End(), as Do_SCPI() uses them.
+ */
+
+#include "../Middlewares/ST/STM32_USB_Device_Library/Class/USBTMC/Src/usbd_usbtmc.c"
+#include "../USB_DEVICE/App/usbd_usbtmc_if.c"
+
+#define CHECK( c )	Check( ( c ) != 0, #c, __LINE__ )
+
+USBD_HandleTypeDef hUsbDeviceFS;
+GPIO_TypeDef host_gpio[2];
+
+static struct {						// Bulk-OUT endpoint
+	uint8_t *buf;
+	uint32_t size;
+	uint8_t armed;
+} out;
+
+static struct {						// Bulk-IN endpoint, the transfer armed
+	uint8_t data[256];
+	uint32_t len, pos;
+	uint8_t armed;
+} in;
+
+static uint8_t ctl[64];				// data stage of the last class request
+static uint16_t ctlLen;
+
+static char rx[1024];				// what the session got from TMC_Getc()
+static uint32_t rxn;
+
+static unsigned checks, failed;
+
+static void Check( int ok, const char *what, int line )
+{
+	++checks;
+	if( !ok )
+	{
+		++failed;
+		printf( "tmctest.c:%d: check failed: %s\n", line, what );
+	}
+}
+
+/* USB device library stubs ------------------------------------------------ */
+
+USBD_StatusTypeDef USBD_LL_OpenEP( USBD_HandleTypeDef *pdev, uint8_t ep_addr, uint8_t ep_type, uint16_t ep_mps )
+{
+	(void)pdev; (void)ep_addr; (void)ep_type; (void)ep_mps;
+	return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_CloseEP( USBD_HandleTypeDef *pdev, uint8_t ep_addr )
+{
+	(void)pdev; (void)ep_addr;
+	return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_Transmit( USBD_HandleTypeDef *pdev, uint8_t ep_addr, uint8_t *pbuf, uint16_t size )
+{
+	(void)pdev;
+	if( ( ep_addr & 0xFU ) != ( TMC_IN_EP & 0xFU ) )		// notifications are not looked at, a ZLP goes to epnum
+		return USBD_OK;
+
+	CHECK( !in.armed );				// one transfer at a time
+	CHECK( size <= sizeof(in.data) );
+	if( size )
+		memcpy( in.data, pbuf, size );
+	in.len = size;
+	in.pos = 0;
+	in.armed = 1;
+	return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_PrepareReceive( USBD_HandleTypeDef *pdev, uint8_t ep_addr, uint8_t *pbuf, uint16_t size )
+{
+	(void)pdev; (void)ep_addr;
+	CHECK( size == TMC_DATA_FS_MAX_PACKET_SIZE );
+	out.buf = pbuf;
+	out.armed = 1;
+	return USBD_OK;
+}
+
+uint32_t USBD_LL_GetRxDataSize( USBD_HandleTypeDef *pdev, uint8_t ep_addr )
+{
+	(void)pdev; (void)ep_addr;
+	return out.size;
+}
+
+USBD_StatusTypeDef USBD_CtlSendData( USBD_HandleTypeDef *pdev, uint8_t *pbuf, uint16_t len )
+{
+	(void)pdev;
+	memcpy( ctl, pbuf, len );
+	ctlLen = len;
+	return USBD_OK;
+}
+
+void USBD_CtlError( USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req )
+{
+	(void)pdev; (void)req;
+	ctlLen = 0;
+}
+
+void SCPI_RxCallback( void )
+{
+}
+
+/* the host side ----------------------------------------------------------- */
+
+static void Session( void )			// the session reads what is waiting
+{
+	int c;
+
+	while( ( c = TMC_Getc() ) >= 0 && rxn < sizeof(rx) - 1 )
+		rx[rxn++] = c;
+	rx[rxn] = 0;
+}
+
+static void HostOut( const uint8_t *pkt, uint32_t len )
+{
+	if( !out.armed )				// NAKed until the session makes room
+		Session();
+	CHECK( out.armed );
+	if( !out.armed )
+		return;
+
+	out.armed = 0;
+	memcpy( out.buf, pkt, len );
+	out.size = len;
+	USBD_TMC.DataOut( &hUsbDeviceFS, TMC_OUT_EP & 0xFU );
+}
+
+static void Header( uint8_t *h, uint8_t msgid, uint8_t tag, uint32_t size, uint8_t attr )
+{
+	memset( h, 0, TMC_HEADER_SIZE );
+	h[0] = msgid;
+	h[1] = tag;
+	h[2] = ~tag;
+	TMC_PUT32( &h[4], size );
+	h[8] = attr;
+}
+
+/* One Bulk-OUT transfer, at most packets of it. */
+static void HostMessage( uint8_t msgid, uint8_t tag, const char *data, uint32_t size, uint8_t eom, int packets )
+{
+	uint8_t buf[512];
+	uint32_t total = TMC_HEADER_SIZE + size, i, n;
+
+	Header( buf, msgid, tag, size, eom ? TMC_ATTR_EOM : 0U );
+	if( size )
+		memcpy( buf + TMC_HEADER_SIZE, data, size );
+	while( total & 3U )
+		buf[total++] = 0xEE;		// alignment bytes, not part of the message
+
+	for( i = 0; i < total && packets--; i += n )
+	{
+		n = MIN( total - i, TMC_DATA_FS_MAX_PACKET_SIZE );
+		HostOut( buf + i, n );
+	}
+}
+
+static void HostSend( const char *text, uint8_t eom )
+{
+	static uint8_t tag = 0;
+
+	tag = ( tag % 255U ) + 1U;
+	HostMessage( TMC_DEV_DEP_MSG_OUT, tag, text, strlen( text ), eom, 99 );
+}
+
+static void HostRequest( uint8_t tag, uint32_t size )
+{
+	uint8_t h[TMC_HEADER_SIZE];
+
+	Header( h, TMC_REQUEST_DEV_DEP_MSG_IN, tag, size, 0U );
+	HostOut( h, sizeof(h) );
+}
+
+/* One Bulk-IN packet, -1 if NAKed. The transfer completes with its last packet. */
+static int HostIn( uint8_t *pkt )
+{
+	uint32_t n;
+
+	if( !in.armed )
+		return -1;
+
+	n = MIN( in.len - in.pos, TMC_DATA_FS_MAX_PACKET_SIZE );
+	memcpy( pkt, in.data + in.pos, n );
+	in.pos += n;
+	if( in.pos == in.len )
+	{
+		in.armed = 0;
+		USBD_TMC.DataIn( &hUsbDeviceFS, TMC_IN_EP & 0xFU );
+	}
+	return n;
+}
+
+/* Bulk-IN packets up to a short one, -1 if NAKed at once. */
+static int HostRead( uint8_t *buf )
+{
+	int n, total = 0;
+
+	do
+	{
+		if( ( n = HostIn( buf + total ) ) < 0 )
+			return total ? total : -1;
+		total += n;
+	} while( n == TMC_DATA_FS_MAX_PACKET_SIZE );
+	return total;
+}
+
+/* Check a DEV_DEP_MSG_IN transfer. */
+static void Response( const uint8_t *buf, int len, uint8_t tag, const char *text, uint8_t eom )
+{
+	uint32_t n = strlen( text );
+	int i;
+
+	CHECK( len == (int)( ( TMC_HEADER_SIZE + n + 3U ) & ~3U ) );
+	CHECK( buf[0] == TMC_DEV_DEP_MSG_IN );
+	CHECK( buf[1] == tag && (uint8_t)( buf[1] ^ buf[2] ) == 0xFFU );
+	CHECK( TMC_GET32( &buf[4] ) == n );
+	CHECK( buf[8] == ( eom ? TMC_ATTR_EOM : 0U ) );
+	CHECK( memcmp( buf + TMC_HEADER_SIZE, text, n ) == 0 );
+	for( i = TMC_HEADER_SIZE + n; i < len; ++i )
+		CHECK( buf[i] == 0 );		// alignment bytes
+}
+
+/* Class request, the status byte of the answer. */
+static uint8_t HostControl( uint8_t recipient, uint8_t request, uint16_t value, uint16_t length )
+{
+	USBD_SetupReqTypedef req = { 0x80U | USB_REQ_TYPE_CLASS | recipient, request, value, 0U, length };
+
+	ctlLen = 0;
+	memset( ctl, 0, sizeof(ctl) );
+	USBD_TMC.Setup( &hUsbDeviceFS, &req );
+	CHECK( ctlLen == length );
+	return ctl[0];
+}
+
+static void Reset( void )
+{
+	memset( &out, 0, sizeof(out) );
+	memset( &in, 0, sizeof(in) );
+	rxn = 0;
+	rx[0] = 0;
+	hUsbDeviceFS.dev_state = USBD_STATE_CONFIGURED;
+	USBD_TMC.DeInit( &hUsbDeviceFS, 0U );
+	USBD_TMC.Init( &hUsbDeviceFS, 0U );
+}
+
+/* the tests --------------------------------------------------------------- */
+
+static void TestHeader( void )
+{
+	uint8_t pkt[TMC_HEADER_SIZE + 4];
+
+	Reset();
+	HostSend( "*IDN?", 1 );
+	Session();
+	CHECK( strcmp( rx, "*IDN?\n" ) == 0 );
+
+	HostSend( "ABC", 1 );			// one alignment byte
+	Session();
+	CHECK( strcmp( rx, "*IDN?\nABC\n" ) == 0 );
+
+	Header( pkt, TMC_DEV_DEP_MSG_OUT, 7U, 4U, TMC_ATTR_EOM );
+	pkt[2] = 7U;					// bTagInverse wrong: dropped
+	memcpy( pkt + TMC_HEADER_SIZE, "BAD!", 4 );
+	HostOut( pkt, sizeof(pkt) );
+	Header( pkt, 99U, 8U, 4U, TMC_ATTR_EOM );	// unknown MsgID: ignored
+	HostOut( pkt, sizeof(pkt) );
+	HostOut( pkt, 5U );				// too short for a header
+	Session();
+	CHECK( strcmp( rx, "*IDN?\nABC\n" ) == 0 );
+	CHECK( out.armed );
+
+	HostMessage( TMC_TRIGGER, 9U, NULL, 0U, 0U, 99 );
+	Session();
+	CHECK( strcmp( rx, "*IDN?\nABC\n*TRG\n" ) == 0 );
+}
+
+static void TestSplit( void )
+{
+	char text[301];
+	int i;
+
+	Reset();
+	for( i = 0; i < 300; ++i )		// five packets, more than the RX ring holds
+		text[i] = 'a' + i % 26;
+	text[300] = 0;
+	HostSend( text, 1 );
+	Session();
+	CHECK( rxn == 301 && memcmp( rx, text, 300 ) == 0 && rx[300] == '\n' );
+
+	Reset();
+	memset( text, 'x', 52 );		// header and message fill exactly one packet
+	text[52] = 0;
+	HostSend( text, 0 );
+	HostSend( "?", 1 );				// so this one is a new transfer
+	Session();
+	CHECK( rxn == 54 && memcmp( rx, text, 52 ) == 0 && strcmp( rx + 52, "?\n" ) == 0 );
+}
+
+static void TestEom( void )
+{
+	Reset();
+	HostSend( "MEAS", 0 );			// the message goes on in the next transfer
+	HostSend( ":VOLT?", 1 );
+	HostSend( "*CLS\n", 1 );		// terminated already: no empty line
+	Session();
+	CHECK( strcmp( rx, "MEAS:VOLT?\n*CLS\n" ) == 0 );
+}
+
+static void TestTransferSize( void )
+{
+	uint8_t buf[256];
+
+	Reset();
+	TMC_Write( (const uint8_t*)"0123456789", 10 );
+	TMC_End();
+	HostRequest( 1U, 5U );			// its alignment bytes cover message bytes kept
+	Response( buf, HostRead( buf ), 1U, "01234", 0 );
+	CHECK( HostRead( buf ) < 0 );	// the rest waits for the next request
+	CHECK( TMC_StatusByte_FS() & STB_MAV );
+	HostRequest( 2U, 100U );
+	Response( buf, HostRead( buf ), 2U, "56789", 1 );
+	CHECK( !( TMC_StatusByte_FS() & STB_MAV ) );
+
+	HostRequest( 3U, 4U );
+	CHECK( HostRead( buf ) < 0 );	// no response yet
+	TMC_Write( (const uint8_t*)"0123456789", 10 );
+	Response( buf, HostRead( buf ), 3U, "0123", 0 );
+	TMC_End();
+	HostRequest( 4U, 100U );
+	Response( buf, HostRead( buf ), 4U, "456789", 0 );
+	HostRequest( 5U, 100U );		// the end came after the transfer went out
+	Response( buf, HostRead( buf ), 5U, "", 1 );
+}
+
+static void TestPadding( void )
+{
+	uint8_t buf[256];
+	char text[53];
+
+	Reset();
+	TMC_Write( (const uint8_t*)"abc", 3 );
+	TMC_End();
+	HostRequest( 3U, 100U );
+	CHECK( in.len == 16 );
+	Response( buf, HostRead( buf ), 3U, "abc", 1 );
+
+	memset( text, 'z', 52 );		// exactly one packet: a ZLP ends the transfer
+	text[52] = 0;
+	TMC_Write( (const uint8_t*)text, 52 );
+	TMC_End();
+	HostRequest( 4U, 100U );
+	CHECK( HostIn( buf ) == 64 );
+	CHECK( TMC_Handle.InBusy );		// not done before the ZLP
+	CHECK( HostIn( buf + 64 ) == 0 );
+	CHECK( !TMC_Handle.InBusy );
+	Response( buf, 64, 4U, text, 1 );
+}
+
+static void TestAbortIn( void )
+{
+	uint8_t buf[256];
+	char text[201];
+
+	Reset();
+	CHECK( HostControl( 0x02U, TMC_INITIATE_ABORT_BULK_IN, 5U, 2U ) == TMC_STATUS_FAILED );
+
+	memset( text, 'r', 200 );		// two buffers
+	text[200] = 0;
+	TMC_Write( (const uint8_t*)text, 200 );
+	TMC_End();
+	HostRequest( 5U, 1000U );
+	CHECK( HostIn( buf ) == 64 );	// first packet of the 128 byte transfer
+
+	CHECK( HostControl( 0x02U, TMC_INITIATE_ABORT_BULK_IN, 6U, 2U ) == TMC_STATUS_TRANSFER_NOT_IN_PROGRESS );
+	CHECK( HostControl( 0x02U, TMC_INITIATE_ABORT_BULK_IN, 5U, 2U ) == TMC_STATUS_SUCCESS && ctl[1] == 5U );
+	CHECK( HostControl( 0x02U, TMC_CHECK_ABORT_BULK_IN_STATUS, 0U, 8U ) == TMC_STATUS_PENDING );
+	CHECK( ctl[1] == 0x01U );		// data in the FIFO
+
+	HostRequest( 6U, 1000U );		// no new transfer before the aborted one is read
+	CHECK( in.armed && in.pos == 64 );
+	CHECK( HostIn( buf ) == 64 );
+	CHECK( HostIn( buf ) == 0 );	// ZLP
+	CHECK( HostControl( 0x02U, TMC_CHECK_ABORT_BULK_IN_STATUS, 0U, 8U ) == TMC_STATUS_SUCCESS );
+	CHECK( ctl[1] == 0U && TMC_GET32( &ctl[4] ) == 116U );
+
+	CHECK( HostRead( buf ) < 0 );	// the rest of the response is gone
+	TMC_Write( (const uint8_t*)"X\n", 2 );
+	TMC_End();
+	Response( buf, HostRead( buf ), 6U, "X\n", 1 );
+
+	TMC_Write( (const uint8_t*)text, 50 );	// aborted while the response is still being written
+	HostRequest( 7U, 10U );
+	Response( buf, HostRead( buf ), 7U, "rrrrrrrrrr", 0 );
+	HostRequest( 8U, 100U );		// the 40 bytes written so far go out
+	CHECK( HostControl( 0x02U, TMC_INITIATE_ABORT_BULK_IN, 8U, 2U ) == TMC_STATUS_SUCCESS );
+	CHECK( HostControl( 0x02U, TMC_CHECK_ABORT_BULK_IN_STATUS, 0U, 8U ) == TMC_STATUS_PENDING );
+	Response( buf, HostRead( buf ), 8U, text + 160, 0 );
+	CHECK( HostControl( 0x02U, TMC_CHECK_ABORT_BULK_IN_STATUS, 0U, 8U ) == TMC_STATUS_SUCCESS );
+	CHECK( TMC_GET32( &ctl[4] ) == 40U );
+	TMC_Write( (const uint8_t*)text, 50 );	// the rest of the aborted response
+	TMC_End();
+	TMC_Write( (const uint8_t*)"Y\n", 2 );
+	TMC_End();
+	HostRequest( 9U, 100U );
+	Response( buf, HostRead( buf ), 9U, "Y\n", 1 );
+}
+
+static void TestAbortOut( void )
+{
+	char text[101];
+
+	Reset();
+	CHECK( HostControl( 0x02U, TMC_INITIATE_ABORT_BULK_OUT, 1U, 2U ) == TMC_STATUS_FAILED );
+
+	memset( text, 'A', 100 );
+	text[100] = 0;
+	HostMessage( TMC_DEV_DEP_MSG_OUT, 1U, text, 100U, 1U, 1 );	// first packet only
+	CHECK( HostControl( 0x02U, TMC_INITIATE_ABORT_BULK_OUT, 1U, 2U ) == TMC_STATUS_SUCCESS );
+	CHECK( HostControl( 0x02U, TMC_CHECK_ABORT_BULK_OUT_STATUS, 0U, 8U ) == TMC_STATUS_SUCCESS );
+	CHECK( TMC_GET32( &ctl[4] ) == 52U );
+	HostSend( "*RST", 1 );
+	Session();
+	CHECK( rxn == 58 && memcmp( rx, text, 52 ) == 0 && rx[52] == SCPI_CANCEL && strcmp( rx + 53, "*RST\n" ) == 0 );
+}
+
+static void TestClear( void )
+{
+	uint8_t buf[256];
+	char text[101];
+
+	Reset();
+	memset( text, 'c', 100 );
+	TMC_Write( (const uint8_t*)text, 100 );
+	TMC_End();
+	HostRequest( 1U, 1000U );
+	CHECK( HostIn( buf ) == 64 );	// first packet of the 112 byte transfer
+	HostSend( "*IDN?", 1 );
+
+	CHECK( HostControl( 0x01U, TMC_INITIATE_CLEAR, 0U, 1U ) == TMC_STATUS_SUCCESS );
+	CHECK( HostControl( 0x01U, TMC_CHECK_CLEAR_STATUS, 0U, 2U ) == TMC_STATUS_PENDING );
+	CHECK( ctl[1] == 0x01U );		// data in the FIFO
+	CHECK( TMC_Write( (const uint8_t*)"lost", 4 ) == 4 );	// dropped until TMC_Clear()
+
+	CHECK( TMC_Clear() == 1 );		// before the host has read the rest
+	CHECK( TMC_Clear() == 0 );
+	Session();
+	CHECK( rxn == 0 );
+	TMC_Write( (const uint8_t*)"Z\n", 2 );
+	TMC_End();
+	HostRequest( 2U, 100U );		// waits for the transfer of before the clear
+	CHECK( HostControl( 0x01U, TMC_CHECK_CLEAR_STATUS, 0U, 2U ) == TMC_STATUS_PENDING );
+	CHECK( HostIn( buf ) == 48 );
+	CHECK( HostControl( 0x01U, TMC_CHECK_CLEAR_STATUS, 0U, 2U ) == TMC_STATUS_SUCCESS );
+	CHECK( ctl[1] == 0U );
+
+	Response( buf, HostRead( buf ), 2U, "Z\n", 1 );
+}
+
+static void TestCapabilities( void )
+{
+	Reset();
+	CHECK( HostControl( 0x01U, TMC_GET_CAPABILITIES, 0U, 24U ) == TMC_STATUS_SUCCESS );
+	CHECK( ctl[2] == 0x00U && ctl[3] == 0x01U );
+	CHECK( ctl[14] == 0x01U );		// TRIGGER, no 488.2 interface
+	CHECK( ctl[15] == 0x05U );		// SR1, DT1, no SCPI
+}
+
+int main( void )
+{
+	USBD_TMC_RegisterInterface( &hUsbDeviceFS, &USBD_TMC_Interface_fops_FS );
+
+	TestHeader();
+	TestSplit();
+	TestEom();
+	TestTransferSize();
+	TestPadding();
+	TestAbortIn();
+	TestAbortOut();
+	TestClear();
+	TestCapabilities();
+
+	printf( "tmctest: %u checks, %u failed\n", checks, failed );
+	return failed ? 1 : 0;
+}
@@ -23,6 +23,8 @@
 #include "usbd_cdc_if.h"
 
 /* USER CODE BEGIN INCLUDE */
+#include <string.h>
+
 #include "scpi.h"
 /* USER CODE END INCLUDE */
 
@@ -63,6 +65,10 @@
   */
 
 /* USER CODE BEGIN PRIVATE_DEFINES */
+#define CDC_TX_BUFFERS		4									// packet buffers carved from UserTxBufferFS
+#define CDC_TX_BUFFER_SIZE	( APP_TX_DATA_SIZE / CDC_TX_BUFFERS / CDC_DATA_FS_MAX_PACKET_SIZE * CDC_DATA_FS_MAX_PACKET_SIZE )	// whole packets
+#define CDC_RX_RING_SIZE	512									// power of 2, behind the OUT packet in UserRxBufferFS
+#define CDC_RX_RING			( UserRxBufferFS + CDC_DATA_FS_MAX_PACKET_SIZE )
 /* USER CODE END PRIVATE_DEFINES */
 
 /**
@@ -95,7 +101,25 @@ uint8_t UserRxBufferFS[APP_RX_DATA_SIZE];
 uint8_t UserTxBufferFS[APP_TX_DATA_SIZE];
 
 /* USER CODE BEGIN PRIVATE_VARIABLES */
-
+/*
+ * TX queue: a ring of packet buffers. CDC_Write() fills txHead, the buffers from txTail up to
+ * txHead are sent one transfer each, chained from the transmit complete callback.
+ * The library appends the zero length packet to transfers of a multiple of 64 bytes and only
+ * then reports completion.
+ */
+static uint16_t txLen[CDC_TX_BUFFERS];		// bytes in each buffer
+static uint8_t txHead = 0;					// buffer being filled
+static uint8_t txTail = 0;					// oldest filled buffer, in flight if txBusy
+static uint8_t txBusy = 0;
+
+/*
+ * RX ring: CDC_Receive_FS() appends each OUT packet, CDC_Getc() takes bytes out.
+ * The next packet is only requested while a full packet fits; otherwise the endpoint NAKs
+ * until CDC_Getc() has made room, so the host is paced and no byte is lost.
+ */
+static volatile uint16_t rxHead = 0;		/* written by CDC_Receive_FS() only */
+static volatile uint16_t rxTail = 0;		/* written by CDC_Getc() only */
+static volatile uint8_t rxPaused = 0;		/* OUT endpoint not armed, ring was full */
 /* USER CODE END PRIVATE_VARIABLES */
 
 /**
@@ -126,9 +150,12 @@ static int8_t CDC_Init_FS(void);
 static int8_t CDC_DeInit_FS(void);
 static int8_t CDC_Control_FS(uint8_t cmd, uint8_t* pbuf, uint16_t length);
 static int8_t CDC_Receive_FS(uint8_t* pbuf, uint32_t *Len);
+static int8_t CDC_TransmitCplt_FS(uint8_t *pbuf, uint32_t *Len, uint8_t epnum);
 
 /* USER CODE BEGIN PRIVATE_FUNCTIONS_DECLARATION */
-
+static void CDC_TxReset(void);
+static void CDC_TxKick(void);
+static uint16_t CDC_RxFree(void);
 /* USER CODE END PRIVATE_FUNCTIONS_DECLARATION */
 
 /**
@@ -140,7 +167,8 @@ USBD_CDC_ItfTypeDef USBD_Interface_fops_FS =
   CDC_Init_FS,
   CDC_DeInit_FS,
   CDC_Control_FS,
-  CDC_Receive_FS
+  CDC_Receive_FS,
+  CDC_TransmitCplt_FS
 };
 
 /* Private functions ---------------------------------------------------------*/
@@ -154,6 +182,8 @@ static int8_t CDC_Init_FS(void)
   /* Set Application Buffers */
   USBD_CDC_SetTxBuffer(&hUsbDeviceFS, UserTxBufferFS, 0);
   USBD_CDC_SetRxBuffer(&hUsbDeviceFS, UserRxBufferFS);
+  CDC_TxReset();
+  rxHead = rxTail = rxPaused = 0;
   return (USBD_OK);
   /* USER CODE END 3 */
 }
@@ -165,6 +195,7 @@ static int8_t CDC_Init_FS(void)
 static int8_t CDC_DeInit_FS(void)
 {
   /* USER CODE BEGIN 4 */
+  CDC_TxReset();
   return (USBD_OK);
   /* USER CODE END 4 */
 }
@@ -260,9 +291,20 @@ static int8_t CDC_Control_FS(uint8_t cmd, uint8_t* pbuf, uint16_t length)
 static int8_t CDC_Receive_FS(uint8_t* Buf, uint32_t *Len)
 {
   /* USER CODE BEGIN 6 */
-  SCPI_CDC_RxCallback(Buf, *Len);
+  uint32_t i;
+
+  for (i = 0; i < *Len; ++i)		/* fits, the packet was only requested with room for it */
+  {
+    CDC_RX_RING[rxHead] = Buf[i];
+    rxHead = (rxHead + 1) & (CDC_RX_RING_SIZE - 1);
+  }
+  SCPI_RxCallback();
+
   USBD_CDC_SetRxBuffer(&hUsbDeviceFS, &Buf[0]);
-  USBD_CDC_ReceivePacket(&hUsbDeviceFS);
+  if (CDC_RxFree() >= CDC_DATA_FS_MAX_PACKET_SIZE)
+    USBD_CDC_ReceivePacket(&hUsbDeviceFS);
+  else
+    rxPaused = 1;
   return (USBD_OK);
   /* USER CODE END 6 */
 }
@@ -292,8 +334,148 @@ uint8_t CDC_Transmit_FS(uint8_t* Buf, uint16_t Len)
   return result;
 }
 
+/**
+  * @brief  CDC_TransmitCplt_FS
+  *         Data transmitted callback
+  *
+  *         @note
+  *         This function is IN transfer complete callback used to inform user that
+  *         the submitted Data is successfully sent over USB.
+  *
+  * @param  Buf: Buffer of data to be received
+  * @param  Len: Number of data received (in bytes)
+  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t CDC_TransmitCplt_FS(uint8_t *Buf, uint32_t *Len, uint8_t epnum)
+{
+  uint8_t result = USBD_OK;
+  /* USER CODE BEGIN 13 */
+  UNUSED(Buf);
+  UNUSED(Len);
+  UNUSED(epnum);
+
+  txLen[txTail] = 0;
+  txTail = (txTail + 1) % CDC_TX_BUFFERS;
+  txBusy = 0;
+  CDC_TxKick();
+  /* USER CODE END 13 */
+  return result;
+}
+
 /* USER CODE BEGIN PRIVATE_FUNCTIONS_IMPLEMENTATION */
+static void CDC_TxReset(void)
+{
+  uint8_t i;
+
+  for (i = 0; i < CDC_TX_BUFFERS; ++i)
+    txLen[i] = 0;
+  txHead = txTail = txBusy = 0;
+}
+
+/* Send the oldest filled buffer, if the endpoint is free. Interrupt context or IRQs disabled. */
+static void CDC_TxKick(void)
+{
+  if (txBusy || txLen[txTail] == 0 || hUsbDeviceFS.dev_state != USBD_STATE_CONFIGURED)
+    return;
+
+  if (txTail == txHead)			/* close the buffer being filled, continue in the next one */
+    txHead = (txHead + 1) % CDC_TX_BUFFERS;
+
+  txBusy = 1;
+  USBD_CDC_SetTxBuffer(&hUsbDeviceFS, &UserTxBufferFS[txTail * CDC_TX_BUFFER_SIZE], txLen[txTail]);
+  if (USBD_CDC_TransmitPacket(&hUsbDeviceFS) != USBD_OK)
+    txBusy = 0;
+}
+
+/**
+  * @brief  Queue data for the IN endpoint, never waits.
+  * @param  Buf: Data to be sent
+  * @param  Len: Number of bytes
+  * @retval Number of bytes accepted, less than Len if the queue is full (backpressure)
+  */
+uint16_t CDC_Write(const uint8_t* Buf, uint16_t Len)
+{
+  uint16_t done = 0, n;
+
+  __disable_irq();
+  while (done < Len)
+  {
+    if (txLen[txHead] == CDC_TX_BUFFER_SIZE)
+    {
+      uint8_t next = (txHead + 1) % CDC_TX_BUFFERS;
+
+      if (next == txTail)		/* all buffers in use */
+        break;
+      txHead = next;
+    }
+
+    n = CDC_TX_BUFFER_SIZE - txLen[txHead];
+    if (n > Len - done)
+      n = Len - done;
+    memcpy(&UserTxBufferFS[txHead * CDC_TX_BUFFER_SIZE + txLen[txHead]], Buf + done, n);
+    txLen[txHead] += n;
+    done += n;
+  }
+  CDC_TxKick();
+  __enable_irq();
+
+  return done;
+}
+
+/**
+  * @brief  Number of bytes CDC_Write() accepts right now.
+  */
+uint16_t CDC_WriteFree(void)
+{
+  uint16_t n;
+  uint8_t b;
+
+  __disable_irq();
+  n = CDC_TX_BUFFER_SIZE - txLen[txHead];
+  for (b = (txHead + 1) % CDC_TX_BUFFERS; b != txTail; b = (b + 1) % CDC_TX_BUFFERS)
+    n += CDC_TX_BUFFER_SIZE;
+  __enable_irq();
+
+  return n;
+}
+
+static uint16_t CDC_RxFree(void)
+{
+  return (rxTail - rxHead - 1) & (CDC_RX_RING_SIZE - 1);
+}
 
+/**
+  * @brief  Number of received bytes waiting for CDC_Getc().
+  */
+uint16_t CDC_ReadAvail(void)
+{
+  return (rxHead - rxTail) & (CDC_RX_RING_SIZE - 1);
+}
+
+/**
+  * @brief  Next received byte, re-arms the OUT endpoint once a packet fits again.
+  * @retval The byte, or -1 if none is waiting
+  */
+int CDC_Getc(void)
+{
+  uint8_t c;
+
+  if (rxTail == rxHead)
+    return -1;
+
+  c = CDC_RX_RING[rxTail];
+  rxTail = (rxTail + 1) & (CDC_RX_RING_SIZE - 1);
+
+  if (rxPaused && CDC_RxFree() >= CDC_DATA_FS_MAX_PACKET_SIZE)
+  {
+    __disable_irq();
+    rxPaused = 0;
+    USBD_CDC_ReceivePacket(&hUsbDeviceFS);
+    __enable_irq();
+  }
+
+  return c;
+}
 /* USER CODE END PRIVATE_FUNCTIONS_IMPLEMENTATION */
 
 /**
@@ -109,7 +109,10 @@ extern USBD_CDC_ItfTypeDef USBD_Interface_fops_FS;
 uint8_t CDC_Transmit_FS(uint8_t* Buf, uint16_t Len);
 
 /* USER CODE BEGIN EXPORTED_FUNCTIONS */
-
+uint16_t CDC_Write(const uint8_t* Buf, uint16_t Len);
+uint16_t CDC_WriteFree(void);
+uint16_t CDC_ReadAvail(void);
+int CDC_Getc(void);
 /* USER CODE END EXPORTED_FUNCTIONS */
 
 /**
@@ -0,0 +1,352 @@
+/**
+  ******************************************************************************
+  * @file           : usbd_composite.c
+  * @brief          : Composite device of the CDC virtual COM port and a
+  *                   USBTMC / USB488 instrument interface.
+  ******************************************************************************
+  *
+  * The ST device core drives a single class, so this one stands in for both:
+  * requests go to USBTMC when they address its interface or one of its
+  * endpoints, everything else goes to CDC, which keeps pClassData and
+  * pUserData to itself. The CDC function is grouped by an interface
+  * association descriptor, so the host binds its two interfaces together.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_composite.h"
+#include "usbd_ctlreq.h"
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+/** @addtogroup USBD_COMPOSITE
+  * @{
+  */
+
+/** @defgroup USBD_COMPOSITE_Private_FunctionPrototypes USBD_COMPOSITE_Private_FunctionPrototypes
+  * @{
+  */
+static uint8_t  USBD_COMPOSITE_Init(USBD_HandleTypeDef *pdev, uint8_t cfgidx);
+static uint8_t  USBD_COMPOSITE_DeInit(USBD_HandleTypeDef *pdev, uint8_t cfgidx);
+static uint8_t  USBD_COMPOSITE_Setup(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req);
+static uint8_t  USBD_COMPOSITE_EP0_RxReady(USBD_HandleTypeDef *pdev);
+static uint8_t  USBD_COMPOSITE_DataIn(USBD_HandleTypeDef *pdev, uint8_t epnum);
+static uint8_t  USBD_COMPOSITE_DataOut(USBD_HandleTypeDef *pdev, uint8_t epnum);
+static uint8_t  *USBD_COMPOSITE_GetFSCfgDesc(uint16_t *length);
+static uint8_t  *USBD_COMPOSITE_GetDeviceQualifierDescriptor(uint16_t *length);
+/**
+  * @}
+  */
+
+/** @defgroup USBD_COMPOSITE_Private_Variables USBD_COMPOSITE_Private_Variables
+  * @{
+  */
+USBD_ClassTypeDef USBD_COMPOSITE =
+{
+  USBD_COMPOSITE_Init,
+  USBD_COMPOSITE_DeInit,
+  USBD_COMPOSITE_Setup,
+  NULL,                 /* EP0_TxSent, */
+  USBD_COMPOSITE_EP0_RxReady,
+  USBD_COMPOSITE_DataIn,
+  USBD_COMPOSITE_DataOut,
+  NULL,
+  NULL,
+  NULL,
+  USBD_COMPOSITE_GetFSCfgDesc,    /* full speed only */
+  USBD_COMPOSITE_GetFSCfgDesc,
+  USBD_COMPOSITE_GetFSCfgDesc,
+  USBD_COMPOSITE_GetDeviceQualifierDescriptor,
+};
+
+/* USB composite device Configuration Descriptor */
+__ALIGN_BEGIN static uint8_t USBD_COMPOSITE_CfgFSDesc[USB_COMPOSITE_CONFIG_DESC_SIZ] __ALIGN_END =
+{
+  /*Configuration Descriptor*/
+  0x09,   /* bLength: Configuration Descriptor size */
+  USB_DESC_TYPE_CONFIGURATION,      /* bDescriptorType: Configuration */
+  LOBYTE(USB_COMPOSITE_CONFIG_DESC_SIZ),  /* wTotalLength:no of returned bytes */
+  HIBYTE(USB_COMPOSITE_CONFIG_DESC_SIZ),
+  0x03,   /* bNumInterfaces: 3 interfaces */
+  0x01,   /* bConfigurationValue: Configuration value */
+  0x00,   /* iConfiguration: Index of string descriptor describing the configuration */
+  0xC0,   /* bmAttributes: self powered */
+  0x32,   /* MaxPower 100 mA */
+
+  /*---------------------------------------------------------------------------*/
+
+  /*Interface Association Descriptor: CDC */
+  0x08,   /* bLength: IAD size */
+  0x0B,   /* bDescriptorType: Interface Association */
+  0x00,   /* bFirstInterface */
+  0x02,   /* bInterfaceCount */
+  0x02,   /* bFunctionClass: Communication Interface Class */
+  0x02,   /* bFunctionSubClass: Abstract Control Model */
+  0x01,   /* bFunctionProtocol: Common AT commands */
+  0x00,   /* iFunction */
+
+  /*Interface Descriptor */
+  0x09,   /* bLength: Interface Descriptor size */
+  USB_DESC_TYPE_INTERFACE,  /* bDescriptorType: Interface */
+  /* Interface descriptor type */
+  0x00,   /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x01,   /* bNumEndpoints: One endpoints used */
+  0x02,   /* bInterfaceClass: Communication Interface Class */
+  0x02,   /* bInterfaceSubClass: Abstract Control Model */
+  0x01,   /* bInterfaceProtocol: Common AT commands */
+  0x00,   /* iInterface: */
+
+  /*Header Functional Descriptor*/
+  0x05,   /* bLength: Endpoint Descriptor size */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x00,   /* bDescriptorSubtype: Header Func Desc */
+  0x10,   /* bcdCDC: spec release number */
+  0x01,
+
+  /*Call Management Functional Descriptor*/
+  0x05,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x01,   /* bDescriptorSubtype: Call Management Func Desc */
+  0x00,   /* bmCapabilities: D0+D1 */
+  0x01,   /* bDataInterface: 1 */
+
+  /*ACM Functional Descriptor*/
+  0x04,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x02,   /* bDescriptorSubtype: Abstract Control Management desc */
+  0x02,   /* bmCapabilities */
+
+  /*Union Functional Descriptor*/
+  0x05,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x06,   /* bDescriptorSubtype: Union func desc */
+  0x00,   /* bMasterInterface: Communication class interface */
+  0x01,   /* bSlaveInterface0: Data Class Interface */
+
+  /*Endpoint 2 Descriptor*/
+  0x07,                           /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,   /* bDescriptorType: Endpoint */
+  CDC_CMD_EP,                     /* bEndpointAddress */
+  0x03,                           /* bmAttributes: Interrupt */
+  LOBYTE(CDC_CMD_PACKET_SIZE),     /* wMaxPacketSize: */
+  HIBYTE(CDC_CMD_PACKET_SIZE),
+  CDC_FS_BINTERVAL,                           /* bInterval: */
+  /*---------------------------------------------------------------------------*/
+
+  /*Data class interface descriptor*/
+  0x09,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_INTERFACE,  /* bDescriptorType: */
+  0x01,   /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x02,   /* bNumEndpoints: Two endpoints used */
+  0x0A,   /* bInterfaceClass: CDC */
+  0x00,   /* bInterfaceSubClass: */
+  0x00,   /* bInterfaceProtocol: */
+  0x00,   /* iInterface: */
+
+  /*Endpoint OUT Descriptor*/
+  0x07,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,      /* bDescriptorType: Endpoint */
+  CDC_OUT_EP,                        /* bEndpointAddress */
+  0x02,                              /* bmAttributes: Bulk */
+  LOBYTE(CDC_DATA_FS_MAX_PACKET_SIZE),  /* wMaxPacketSize: */
+  HIBYTE(CDC_DATA_FS_MAX_PACKET_SIZE),
+  0x00,                              /* bInterval: ignore for Bulk transfer */
+
+  /*Endpoint IN Descriptor*/
+  0x07,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,      /* bDescriptorType: Endpoint */
+  CDC_IN_EP,                         /* bEndpointAddress */
+  0x02,                              /* bmAttributes: Bulk */
+  LOBYTE(CDC_DATA_FS_MAX_PACKET_SIZE),  /* wMaxPacketSize: */
+  HIBYTE(CDC_DATA_FS_MAX_PACKET_SIZE),
+  0x00,                              /* bInterval: ignore for Bulk transfer */
+
+  /*---------------------------------------------------------------------------*/
+
+  /*USBTMC interface descriptor*/
+  0x09,   /* bLength: Interface Descriptor size */
+  USB_DESC_TYPE_INTERFACE,  /* bDescriptorType: Interface */
+  TMC_INTERFACE,  /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x03,   /* bNumEndpoints: Bulk-OUT, Bulk-IN, Interrupt IN */
+  0xFE,   /* bInterfaceClass: Application Specific */
+  0x03,   /* bInterfaceSubClass: USBTMC */
+  0x01,   /* bInterfaceProtocol: USB488 */
+  0x00,   /* iInterface: */
+
+  /*Endpoint OUT Descriptor*/
+  0x07,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,      /* bDescriptorType: Endpoint */
+  TMC_OUT_EP,                        /* bEndpointAddress */
+  0x02,                              /* bmAttributes: Bulk */
+  LOBYTE(TMC_DATA_FS_MAX_PACKET_SIZE),  /* wMaxPacketSize: */
+  HIBYTE(TMC_DATA_FS_MAX_PACKET_SIZE),
+  0x00,                              /* bInterval: ignore for Bulk transfer */
+
+  /*Endpoint IN Descriptor*/
+  0x07,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,      /* bDescriptorType: Endpoint */
+  TMC_IN_EP,                         /* bEndpointAddress */
+  0x02,                              /* bmAttributes: Bulk */
+  LOBYTE(TMC_DATA_FS_MAX_PACKET_SIZE),  /* wMaxPacketSize: */
+  HIBYTE(TMC_DATA_FS_MAX_PACKET_SIZE),
+  0x00,                              /* bInterval: ignore for Bulk transfer */
+
+  /*Endpoint Interrupt IN Descriptor*/
+  0x07,                           /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,         /* bDescriptorType: Endpoint */
+  TMC_INT_EP,                     /* bEndpointAddress */
+  0x03,                           /* bmAttributes: Interrupt */
+  LOBYTE(TMC_INT_PACKET_SIZE),    /* wMaxPacketSize: */
+  HIBYTE(TMC_INT_PACKET_SIZE),
+  TMC_FS_BINTERVAL                /* bInterval: */
+};
+/**
+  * @}
+  */
+
+/** @defgroup USBD_COMPOSITE_Private_Functions USBD_COMPOSITE_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Whether a request addresses the USBTMC function
+  * @param  req: usb request
+  * @retval 1 for USBTMC, 0 for CDC
+  */
+static uint8_t USBD_COMPOSITE_IsTMC(USBD_SetupReqTypedef *req)
+{
+  switch (req->bmRequest & USB_REQ_RECIPIENT_MASK)
+  {
+    case USB_REQ_RECIPIENT_INTERFACE:
+      return LOBYTE(req->wIndex) == TMC_INTERFACE;
+
+    case USB_REQ_RECIPIENT_ENDPOINT:
+      return (LOBYTE(req->wIndex) & 0x7FU) == (TMC_OUT_EP & 0x7FU) ||
+             (LOBYTE(req->wIndex) & 0x7FU) == (TMC_INT_EP & 0x7FU);
+
+    default:
+      return 0U;
+  }
+}
+
+/**
+  * @brief  Initialize both functions
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t USBD_COMPOSITE_Init(USBD_HandleTypeDef *pdev, uint8_t cfgidx)
+{
+  uint8_t ret = USBD_CDC.Init(pdev, cfgidx);
+
+  return ret | USBD_TMC.Init(pdev, cfgidx);
+}
+
+/**
+  * @brief  DeInitialize both functions
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t USBD_COMPOSITE_DeInit(USBD_HandleTypeDef *pdev, uint8_t cfgidx)
+{
+  USBD_TMC.DeInit(pdev, cfgidx);
+
+  return USBD_CDC.DeInit(pdev, cfgidx);
+}
+
+/**
+  * @brief  Pass a request on to the function it addresses
+  * @param  pdev: device instance
+  * @param  req: usb request
+  * @retval status
+  */
+static uint8_t USBD_COMPOSITE_Setup(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req)
+{
+  if (USBD_COMPOSITE_IsTMC(req))
+  {
+    return USBD_TMC.Setup(pdev, req);
+  }
+
+  return USBD_CDC.Setup(pdev, req);
+}
+
+/**
+  * @brief  EP0 data stage of an OUT request, only CDC has those
+  * @param  pdev: device instance
+  * @retval status
+  */
+static uint8_t USBD_COMPOSITE_EP0_RxReady(USBD_HandleTypeDef *pdev)
+{
+  return USBD_CDC.EP0_RxReady(pdev);
+}
+
+/**
+  * @brief  Data sent on non-control IN endpoint
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t USBD_COMPOSITE_DataIn(USBD_HandleTypeDef *pdev, uint8_t epnum)
+{
+  if (epnum == (TMC_IN_EP & 0x7FU) || epnum == (TMC_INT_EP & 0x7FU))
+  {
+    return USBD_TMC.DataIn(pdev, epnum);
+  }
+
+  return USBD_CDC.DataIn(pdev, epnum);
+}
+
+/**
+  * @brief  Data received on non-control OUT endpoint
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t USBD_COMPOSITE_DataOut(USBD_HandleTypeDef *pdev, uint8_t epnum)
+{
+  if (epnum == TMC_OUT_EP)
+  {
+    return USBD_TMC.DataOut(pdev, epnum);
+  }
+
+  return USBD_CDC.DataOut(pdev, epnum);
+}
+
+/**
+  * @brief  Return configuration descriptor
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t *USBD_COMPOSITE_GetFSCfgDesc(uint16_t *length)
+{
+  *length = sizeof(USBD_COMPOSITE_CfgFSDesc);
+  return USBD_COMPOSITE_CfgFSDesc;
+}
+
+/**
+  * @brief  Return Device Qualifier descriptor
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t *USBD_COMPOSITE_GetDeviceQualifierDescriptor(uint16_t *length)
+{
+  return USBD_CDC.GetDeviceQualifierDescriptor(length);
+}
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
@@ -0,0 +1,58 @@
+/**
+  ******************************************************************************
+  * @file           : usbd_composite.h
+  * @brief          : Header for usbd_composite.c file.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USBD_COMPOSITE_H__
+#define __USBD_COMPOSITE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_cdc.h"
+#include "usbd_usbtmc.h"
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @brief For Usb device.
+  * @{
+  */
+
+/** @defgroup USBD_COMPOSITE USBD_COMPOSITE
+  * @brief Composite device: CDC (interfaces 0, 1) and USBTMC (interface 2).
+  * @{
+  */
+
+/** @defgroup USBD_COMPOSITE_Exported_Defines USBD_COMPOSITE_Exported_Defines
+  * @{
+  */
+#define USB_COMPOSITE_CONFIG_DESC_SIZ     (USB_CDC_CONFIG_DESC_SIZ + 8U + USB_TMC_INTERFACE_DESC_SIZ)  /* CDC with IAD, USBTMC */
+/**
+  * @}
+  */
+
+/** @defgroup USBD_COMPOSITE_Exported_Variables USBD_COMPOSITE_Exported_Variables
+  * @{
+  */
+extern USBD_ClassTypeDef USBD_COMPOSITE;
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __USBD_COMPOSITE_H__ */
@@ -0,0 +1,524 @@
+/**
+  ******************************************************************************
+  * @file           : usbd_usbtmc_if.c
+  * @brief          : Usb device for the USBTMC / USB488 instrument interface,
+  *                   the byte stream of a SCPI session.
+  ******************************************************************************
+  *
+  * The message bytes of each DEV_DEP_MSG_OUT go into an RX ring for TMC_Getc(),
+  * the end of a message (EOM) terminates the command line, a TRIGGER message
+  * becomes a "*TRG" line. So both keep their order with the commands around.
+  * An aborted message leaves SCPI_CANCEL in the ring, the session drops the
+  * line it was assembling.
+  *
+  * Responses are written into a ring of buffers, each one Bulk-IN transfer with
+  * room for the USBTMC header in front. TMC_End() closes the buffer at the end
+  * of a response, it goes out with EOM set. A buffer is only sent in answer to
+  * a REQUEST_DEV_DEP_MSG_IN, once the response is complete, the buffer full or
+  * TransferSize reached; whatever does not fit into TransferSize stays for the
+  * next request. INITIATE_ABORT_BULK_IN drops the rest of the response, once
+  * the transfer in flight is done.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "usbd_usbtmc_if.h"
+#include "scpi.h"
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @brief Usb device library.
+  * @{
+  */
+
+/** @addtogroup USBD_USBTMC_IF
+  * @{
+  */
+
+/** @defgroup USBD_USBTMC_IF_Private_Defines USBD_USBTMC_IF_Private_Defines
+  * @brief Private defines.
+  * @{
+  */
+#define TMC_RX_RING_SIZE    128                                     /* power of 2 */
+#define TMC_TX_BUFFERS      2
+#define TMC_TX_BUFFER_SIZE  128                                     /* header, message bytes, alignment */
+#define TMC_TX_PAYLOAD      (TMC_TX_BUFFER_SIZE - TMC_HEADER_SIZE)  /* a multiple of 4, so the alignment bytes always fit */
+#define TMC_TX_DATA(b)      ((uint8_t *)txBuf[b] + TMC_HEADER_SIZE)
+#define TMC_TX_PAD(n)       ((4U - ((n) & 3U)) & 3U)                /* alignment bytes behind n message bytes */
+/**
+  * @}
+  */
+
+/** @defgroup USBD_USBTMC_IF_Private_Variables USBD_USBTMC_IF_Private_Variables
+  * @brief Private variables.
+  * @{
+  */
+static uint8_t rxRing[TMC_RX_RING_SIZE];
+static volatile uint16_t rxHead = 0;        /* written by the USB interrupt only */
+static volatile uint16_t rxTail = 0;        /* written by TMC_Getc() / TMC_Clear() only */
+static volatile uint8_t rxPaused = 0;       /* OUT endpoint not armed, ring was full */
+static uint8_t rxLast = '\n';               /* last byte put into the ring */
+
+static uint32_t txBuf[TMC_TX_BUFFERS][TMC_TX_BUFFER_SIZE / 4];   /* Force 32bits alignment */
+static uint16_t txLen[TMC_TX_BUFFERS];      /* message bytes in each buffer */
+static uint8_t txEom[TMC_TX_BUFFERS];       /* closed by TMC_End(), the message ends with it */
+static uint8_t txHead = 0;                  /* buffer being filled */
+static uint8_t txTail = 0;                  /* oldest filled buffer, in flight if txBusy */
+static uint8_t txBusy = 0;
+static uint16_t txSent = 0;                 /* message bytes of the transfer in flight */
+static uint8_t txPad[3];                    /* the bytes behind them, overwritten by the alignment */
+static uint8_t txPartial = 0;               /* a response went out in part, its end did not yet */
+static uint8_t txAbort = 0;                 /* drop the rest of the response after the transfer in flight */
+static volatile uint8_t txDiscard = 0;      /* drop what is written up to TMC_End(), the response was aborted */
+
+static volatile uint8_t clearing = 0;       /* INITIATE_CLEAR received, until TMC_Clear() */
+static volatile uint8_t stb = 0;            /* status byte of the session, without MAV */
+static uint8_t srq = 0;                     /* SRQ notification still to send */
+/**
+  * @}
+  */
+
+/** @defgroup USBD_USBTMC_IF_Exported_Variables USBD_USBTMC_IF_Exported_Variables
+  * @brief Public variables.
+  * @{
+  */
+extern USBD_HandleTypeDef hUsbDeviceFS;
+/**
+  * @}
+  */
+
+/** @defgroup USBD_USBTMC_IF_Private_FunctionPrototypes USBD_USBTMC_IF_Private_FunctionPrototypes
+  * @brief Private functions declaration.
+  * @{
+  */
+static int8_t TMC_Init_FS(void);
+static int8_t TMC_DeInit_FS(void);
+static int8_t TMC_Receive_FS(uint8_t *Buf, uint32_t Len, uint8_t eom);
+static int8_t TMC_Trigger_FS(void);
+static int8_t TMC_Request_FS(void);
+static int8_t TMC_TransmitCplt_FS(void);
+static int8_t TMC_AbortIn_FS(void);
+static int8_t TMC_AbortOut_FS(void);
+static int8_t TMC_Clear_FS(void);
+static uint8_t TMC_Cleared_FS(void);
+static uint8_t TMC_StatusByte_FS(void);
+
+static void TMC_TxReset(void);
+static void TMC_TxKick(void);
+static void TMC_TxDrop(void);
+static uint16_t TMC_RxFree(void);
+static void TMC_RxPut(uint8_t c);
+/**
+  * @}
+  */
+
+USBD_TMC_ItfTypeDef USBD_TMC_Interface_fops_FS =
+{
+  TMC_Init_FS,
+  TMC_DeInit_FS,
+  TMC_Receive_FS,
+  TMC_Trigger_FS,
+  TMC_Request_FS,
+  TMC_TransmitCplt_FS,
+  TMC_AbortIn_FS,
+  TMC_AbortOut_FS,
+  TMC_Clear_FS,
+  TMC_Cleared_FS,
+  TMC_StatusByte_FS
+};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Initializes the USBTMC media low layer
+  * @retval USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TMC_Init_FS(void)
+{
+  TMC_TxReset();
+  rxHead = rxTail = rxPaused = clearing = srq = 0;
+  rxLast = '\n';
+  return (USBD_OK);
+}
+
+/**
+  * @brief  DeInitializes the USBTMC media low layer
+  * @retval USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TMC_DeInit_FS(void)
+{
+  TMC_TxReset();
+  return (USBD_OK);
+}
+
+/**
+  * @brief  Message bytes of a Bulk-OUT packet, USB interrupt
+  * @param  Buf: Message bytes
+  * @param  Len: Number of them, 0 for a packet without any
+  * @param  eom: they end the message
+  * @retval USBD_OK
+  */
+static int8_t TMC_Receive_FS(uint8_t *Buf, uint32_t Len, uint8_t eom)
+{
+  uint32_t i;
+
+  for (i = 0; i < Len; ++i)         /* fits, the packet was only requested with room for it */
+    TMC_RxPut(Buf[i]);
+
+  if (eom && rxLast != '\n')        /* the end of the message terminates the command line */
+    TMC_RxPut('\n');
+
+  SCPI_RxCallback();
+
+  if (TMC_RxFree() > TMC_DATA_FS_MAX_PACKET_SIZE)
+    USBD_TMC_ReceivePacket(&hUsbDeviceFS);
+  else
+    rxPaused = 1;
+  return (USBD_OK);
+}
+
+/**
+  * @brief  USB488 TRIGGER message, USB interrupt: a *TRG in line with the commands
+  * @retval USBD_OK
+  */
+static int8_t TMC_Trigger_FS(void)
+{
+  const char *trg = "*TRG\n";
+
+  if (rxLast != '\n')
+    TMC_RxPut('\n');
+  while (*trg)
+    TMC_RxPut(*trg++);
+  return (USBD_OK);
+}
+
+/**
+  * @brief  REQUEST_DEV_DEP_MSG_IN, USB interrupt: send the response if there is one
+  * @retval USBD_OK
+  */
+static int8_t TMC_Request_FS(void)
+{
+  TMC_TxKick();
+  return (USBD_OK);
+}
+
+/**
+  * @brief  Bulk-IN transfer done, USB interrupt
+  * @retval USBD_OK
+  */
+static int8_t TMC_TransmitCplt_FS(void)
+{
+  uint8_t ended;
+
+  if (!txBusy)                      /* sent before a device clear, its buffer is gone */
+  {
+    TMC_TxKick();
+    return (USBD_OK);
+  }
+
+  ended = txEom[txTail] && txSent == txLen[txTail];
+  memcpy(TMC_TX_DATA(txTail) + txSent, txPad, TMC_TX_PAD(txSent));
+  txLen[txTail] -= txSent;
+  if (txLen[txTail])                /* beyond TransferSize, goes out with the next request */
+  {
+    memmove(TMC_TX_DATA(txTail), TMC_TX_DATA(txTail) + txSent, txLen[txTail]);
+  }
+  else
+  {
+    txEom[txTail] = 0;
+    txTail = (txTail + 1) % TMC_TX_BUFFERS;
+  }
+  txSent = 0;
+  txBusy = 0;
+  txPartial = !ended;
+  if (txAbort)
+  {
+    txAbort = 0;
+    if (!ended)
+      TMC_TxDrop();
+  }
+  TMC_TxKick();
+  return (USBD_OK);
+}
+
+/**
+  * @brief  INITIATE_ABORT_BULK_IN, USB interrupt: the rest of the response is
+  *         dropped, after the transfer in flight
+  * @retval USBD_OK
+  */
+static int8_t TMC_AbortIn_FS(void)
+{
+  if (txBusy)
+    txAbort = 1;
+  else
+    TMC_TxDrop();
+  return (USBD_OK);
+}
+
+/**
+  * @brief  INITIATE_ABORT_BULK_OUT, USB interrupt: a command line cut off by
+  *         the abort is dropped by the session
+  * @retval USBD_OK
+  */
+static int8_t TMC_AbortOut_FS(void)
+{
+  if (rxLast == '\n')
+    return (USBD_OK);
+
+  if (!TMC_RxFree())                /* the last byte is not read yet, it belongs to the line */
+    rxHead = (rxHead - 1) & (TMC_RX_RING_SIZE - 1);
+  TMC_RxPut(SCPI_CANCEL);
+  rxLast = '\n';
+  SCPI_RxCallback();
+  return (USBD_OK);
+}
+
+/**
+  * @brief  INITIATE_CLEAR, USB interrupt: responses are dropped at once,
+  *         the input and the session when Do_SCPI() calls TMC_Clear()
+  * @retval USBD_OK
+  */
+static int8_t TMC_Clear_FS(void)
+{
+  clearing = 1;
+  TMC_TxReset();
+  SCPI_RxCallback();
+  return (USBD_OK);
+}
+
+/**
+  * @brief  CHECK_CLEAR_STATUS
+  * @retval 0 while the session is not yet cleared
+  */
+static uint8_t TMC_Cleared_FS(void)
+{
+  return !clearing;
+}
+
+/**
+  * @brief  READ_STATUS_BYTE
+  * @retval The status byte, MAV while a response is waiting
+  */
+static uint8_t TMC_StatusByte_FS(void)
+{
+  return stb | ((txLen[txTail] || txEom[txTail]) ? STB_MAV : 0);
+}
+
+static void TMC_TxReset(void)
+{
+  uint8_t i;
+  for (i = 0; i < TMC_TX_BUFFERS; ++i)
+    txLen[i] = txEom[i] = 0;
+  txHead = txTail = txBusy = 0;
+  txSent = 0;
+  txPartial = txAbort = txDiscard = 0;
+}
+
+/* Drop the response at the tail up to its end, what TMC_Write() still adds of it too. Interrupt context. */
+static void TMC_TxDrop(void)
+{
+  uint8_t eom;
+
+  if (!txLen[txTail] && !txEom[txTail] && !txPartial)
+    return;                         /* nothing of it queued or sent */
+
+  txPartial = 0;
+  for (;;)
+  {
+    eom = txEom[txTail];
+    txLen[txTail] = txEom[txTail] = 0;
+    if (txTail == txHead)
+    {
+      txDiscard = !eom;
+      break;
+    }
+    txTail = (txTail + 1) % TMC_TX_BUFFERS;
+    if (eom)
+      break;
+  }
+}
+
+/* Answer the request with the oldest buffer, if it can go. Interrupt context or IRQs disabled. */
+static void TMC_TxKick(void)
+{
+  uint32_t max;
+  uint16_t n;
+
+  if (txBusy || (!txLen[txTail] && !txEom[txTail]) || hUsbDeviceFS.dev_state != USBD_STATE_CONFIGURED)
+    return;
+
+  max = USBD_TMC_Requested(&hUsbDeviceFS);
+  if (!max)
+    return;
+
+  if (txTail == txHead && !txEom[txTail] && txLen[txTail] < TMC_TX_PAYLOAD && txLen[txTail] < max)
+    return;                         /* more of the response to come, it goes in one transfer */
+
+  n = (txLen[txTail] > max) ? max : txLen[txTail];
+  if (txTail == txHead)             /* close the buffer being filled, continue in the next one */
+    txHead = (txHead + 1) % TMC_TX_BUFFERS;
+  txBusy = 1;
+  txSent = n;
+  memcpy(txPad, TMC_TX_DATA(txTail) + n, TMC_TX_PAD(n));
+  if (USBD_TMC_Transmit(&hUsbDeviceFS, (uint8_t *)txBuf[txTail], n, txEom[txTail] && n == txLen[txTail]) != USBD_OK)
+    txBusy = 0;
+}
+
+/**
+  * @brief  Queue response bytes, never waits.
+  * @param  Buf: Data to be sent
+  * @param  Len: Number of bytes
+  * @retval Number of bytes accepted, less than Len if the queue is full (backpressure)
+  */
+uint16_t TMC_Write(const uint8_t* Buf, uint16_t Len)
+{
+  uint16_t done = 0, n;
+
+  if (clearing)                     /* dropped anyway */
+    return Len;
+
+  __disable_irq();
+  if (txDiscard)                    /* the rest of an aborted response */
+    done = Len;
+  while (done < Len)
+  {
+    if (txLen[txHead] == TMC_TX_PAYLOAD || txEom[txHead])
+    {
+      uint8_t next = (txHead + 1) % TMC_TX_BUFFERS;
+      if (next == txTail)           /* all buffers in use */
+        break;
+      txHead = next;
+    }
+    n = TMC_TX_PAYLOAD - txLen[txHead];
+    if (n > Len - done)
+      n = Len - done;
+    memcpy(TMC_TX_DATA(txHead) + txLen[txHead], Buf + done, n);
+    txLen[txHead] += n;
+    done += n;
+  }
+  TMC_TxKick();
+  __enable_irq();
+  return done;
+}
+
+/**
+  * @brief  Number of bytes TMC_Write() accepts right now.
+  */
+uint16_t TMC_WriteFree(void)
+{
+  uint16_t n;
+  uint8_t b;
+
+  if (clearing || txDiscard)
+    return TMC_TX_BUFFERS * TMC_TX_PAYLOAD;
+
+  __disable_irq();
+  n = txEom[txHead] ? 0 : TMC_TX_PAYLOAD - txLen[txHead];
+  for (b = (txHead + 1) % TMC_TX_BUFFERS; b != txTail; b = (b + 1) % TMC_TX_BUFFERS)
+    n += TMC_TX_PAYLOAD;
+  __enable_irq();
+  return n;
+}
+
+/**
+  * @brief  The response written is complete: its last transfer gets EOM.
+  */
+void TMC_End(void)
+{
+  if (clearing)
+    return;
+
+  __disable_irq();
+  if (txDiscard)                    /* the aborted response is over */
+  {
+    txDiscard = 0;
+  }
+  else
+  {
+    txEom[txHead] = 1;              /* even if empty: the rest of the response already went out */
+    TMC_TxKick();
+  }
+  __enable_irq();
+}
+
+/**
+  * @brief  Device clear, for Do_SCPI(): drops the input and what was written
+  *         since the INITIATE_CLEAR, then CHECK_CLEAR_STATUS reports success.
+  * @retval 1 once after a device clear, the session must be reset
+  */
+uint8_t TMC_Clear(void)
+{
+  if (!clearing)
+    return 0;
+
+  __disable_irq();
+  TMC_TxReset();
+  rxTail = rxHead;
+  rxLast = '\n';
+  clearing = 0;
+  if (rxPaused)
+  {
+    rxPaused = 0;
+    USBD_TMC_ReceivePacket(&hUsbDeviceFS);
+  }
+  __enable_irq();
+  return 1;
+}
+
+/**
+  * @brief  Status byte of the session, from Do_SCPI(); a new MSS is sent as SRQ
+  *         on the Interrupt IN endpoint.
+  * @param  status: STB_xxx
+  */
+void TMC_Status(uint8_t status)
+{
+  __disable_irq();
+  if ((status & STB_MSS) && !(stb & STB_MSS))
+    srq = 1;
+  stb = status;
+  if (srq && USBD_TMC_Notify(&hUsbDeviceFS, TMC_NOTIFY_SRQ, status) != USBD_BUSY)
+    srq = 0;                        /* sent, or not configured */
+  __enable_irq();
+}
+
+static uint16_t TMC_RxFree(void)
+{
+  return (rxTail - rxHead - 1) & (TMC_RX_RING_SIZE - 1);
+}
+
+static void TMC_RxPut(uint8_t c)
+{
+  rxRing[rxHead] = c;
+  rxHead = (rxHead + 1) & (TMC_RX_RING_SIZE - 1);
+  rxLast = c;
+}
+
+/**
+  * @brief  Next received byte, re-arms the OUT endpoint once a packet fits again.
+  * @retval The byte, or -1 if none is waiting
+  */
+int TMC_Getc(void)
+{
+  uint8_t c;
+
+  if (clearing || rxTail == rxHead)
+    return -1;
+
+  c = rxRing[rxTail];
+  rxTail = (rxTail + 1) & (TMC_RX_RING_SIZE - 1);
+  if (rxPaused && TMC_RxFree() > TMC_DATA_FS_MAX_PACKET_SIZE)
+  {
+    __disable_irq();
+    rxPaused = 0;
+    USBD_TMC_ReceivePacket(&hUsbDeviceFS);
+    __enable_irq();
+  }
+  return c;
+}
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
@@ -0,0 +1,68 @@
+/**
+  ******************************************************************************
+  * @file           : usbd_usbtmc_if.h
+  * @brief          : Header for usbd_usbtmc_if.c file.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USBD_USBTMC_IF_H__
+#define __USBD_USBTMC_IF_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_usbtmc.h"
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @brief For Usb device.
+  * @{
+  */
+
+/** @defgroup USBD_USBTMC_IF USBD_USBTMC_IF
+  * @brief Usb instrument (USBTMC / USB488) device module
+  * @{
+  */
+
+/** @defgroup USBD_USBTMC_IF_Exported_Variables USBD_USBTMC_IF_Exported_Variables
+  * @brief Public variables.
+  * @{
+  */
+
+extern USBD_TMC_ItfTypeDef USBD_TMC_Interface_fops_FS;
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_USBTMC_IF_Exported_FunctionsPrototype USBD_USBTMC_IF_Exported_FunctionsPrototype
+  * @brief Public functions declaration.
+  * @{
+  */
+
+int TMC_Getc(void);
+uint16_t TMC_Write(const uint8_t* Buf, uint16_t Len);
+uint16_t TMC_WriteFree(void);
+void TMC_End(void);
+uint8_t TMC_Clear(void);
+void TMC_Status(uint8_t stb);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __USBD_USBTMC_IF_H__ */